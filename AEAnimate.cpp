@@ -1,10 +1,16 @@
 #include "emp/math/Random.hpp"
 #include "emp/web/Animate.hpp"
 #include "emp/web/web.hpp"
+#include <algorithm>
+#include <cstring>
+#include <emscripten.h>
 #include "World.h"
 #include "Org.h"
 #include "Mouse.h"
 #include "Owl.h"
+#include "Setup.h"
+#include "PixelBuffer.h"
+#include "WorkerProtocol.h"
 
 emp::web::Document doc{"target"};
 
@@ -20,12 +26,31 @@ class AEAnimator : public emp::web::Animate {
         // Seed to control random number generation
         static constexpr int SEED = 6;    ///< Seed for random number generator
 
-        // Arena dimensions and visual parameters
-        static constexpr int NUM_H_BOXES = 20;    ///< Grid height in cells
-        static constexpr int NUM_W_BOXES = 20;    ///< Grid width in cells
-        static constexpr double RECT_SIDE = 20;   ///< Size of each cell in pixels
-        static constexpr double WIDTH = NUM_W_BOXES * RECT_SIDE;  ///< Canvas width
-        static constexpr double HEIGHT = NUM_H_BOXES * RECT_SIDE; ///< Canvas height
+        // Arena dimensions and visual parameters, overridden by the page's
+        // ?width=, ?height= and ?cell= query parameters
+        static constexpr int DEFAULT_BOXES = 20;          ///< Grid width and height in cells
+        static constexpr int MAX_BOXES = 4096;            ///< Largest grid side accepted
+        static constexpr int DEFAULT_CANVAS_SIDE = 400;   ///< Longest canvas side in pixels when ?cell= is absent
+        static constexpr int MAX_RECT_SIDE = 64;          ///< Largest cell size accepted in pixels
+
+        // Draw through a per-cell pixel buffer uploaded once per frame; false
+        // draws one outlined rectangle per cell, which only suits small grids
+        static constexpr bool USE_PIXEL_BUFFER = true;
+
+        /**
+         * @brief How simulation steps are paced against animation frames
+         */
+        enum class RunMode {
+            STEPS_PER_FRAME,  ///< Run steps_per_frame updates per frame
+            TIME_BUDGET,      ///< Run updates until FRAME_BUDGET_MS has passed, at least one
+            WORKER            ///< Run updates in AEWorker.js and draw the snapshots it posts back
+        };
+        static constexpr double FRAME_BUDGET_MS = 12.0;  ///< Simulation time per frame in TIME_BUDGET mode
+        static constexpr size_t MAX_STEPS_PER_FRAME = 1024; ///< Upper limit for the Faster button
+
+        // Population chart below the grid, one sample per frame
+        static constexpr size_t CHART_SAMPLES = 200;  ///< Frames of history shown
+        static constexpr double CHART_HEIGHT = 120;   ///< Chart canvas height in pixels
 
         // Population density parameters
         static constexpr int MOUSE_DENSITY_RATIO = 4;   ///< Fraction of cells with mice (1/4)
@@ -35,24 +60,42 @@ class AEAnimator : public emp::web::Animate {
         static constexpr double INITIAL_MOUSE_ENERGY = 600.0;
         static constexpr double INITIAL_OWL_ENERGY = 500.0;
 
+        size_t num_w_boxes;                ///< Grid width in cells
+        size_t num_h_boxes;                ///< Grid height in cells
+        double rect_side;                  ///< Size of each cell in pixels
         emp::web::Canvas canvas;           ///< Canvas for rendering the simulation
         emp::Random random_generator;      ///< Random number generator
         OrgWorld world;                    ///< The ecosystem world
+        SpeciesPixelBuffer pixels;         ///< One pixel per cell for the pixel-buffer path
+        RunMode run_mode = RunMode::STEPS_PER_FRAME; ///< Pacing used by DoFrame, switched by the Pacing button
+        size_t steps_per_frame = 1;        ///< Updates per frame (or per worker request)
+        emp::web::Text speed_text;         ///< Shows the current pacing
+        worker_handle worker = 0;          ///< Ecology worker, started the first time WORKER mode is chosen
+        bool worker_busy = false;          ///< A worker request is in flight
+        bool worker_synced = false;        ///< The worker's world continues this animator's
+        emp::vector<char> worker_message;  ///< Reused request buffer
+        emp::web::Canvas chart;            ///< Population of each species over recent frames
+        emp::web::Text stats_text;         ///< Current counts and mean energies
+        emp::vector<uint32_t> chart_counts; ///< Per frame, one count per registered species, oldest first
 
-        // Visualization colors
+        // Visualization colors (each species' color comes from its class)
         const std::string grass_color = "green";
-        const std::string mouse_color = "gray";
-        const std::string owl_color = "brown";
 
     public:
         /**
          * @brief Construct the animator and set up the simulation
          */
-        AEAnimator() : canvas(WIDTH, HEIGHT, "canvas"), 
+        AEAnimator() : num_w_boxes(GetPageSetting("width", DEFAULT_BOXES, NeighborStencil::MIN_SIDE, MAX_BOXES)),
+                      num_h_boxes(GetPageSetting("height", DEFAULT_BOXES, NeighborStencil::MIN_SIDE, MAX_BOXES)),
+                      rect_side(GetPageSetting("cell", std::max<int>(DEFAULT_CANVAS_SIDE / std::max(num_w_boxes, num_h_boxes), 1),
+                                               1, MAX_RECT_SIDE)),
+                      canvas(num_w_boxes * rect_side, num_h_boxes * rect_side, "canvas"),
                       random_generator(SEED), 
-                      world(random_generator) {
+                      world(random_generator),
+                      chart(num_w_boxes * rect_side, CHART_HEIGHT, "chart") {
             SetupInterface();
             InitializeWorld();
+            SetupPixelBuffer();
         }
 
         /**
@@ -62,11 +105,72 @@ class AEAnimator : public emp::web::Animate {
          * Note: UpdateEcology logic has been moved to World.h for better organization.
          */
         void DoFrame() override {
+            // After leaving WORKER mode, wait for the batch in flight and carry on from it
+            if (worker_busy) return;
+            if (run_mode == RunMode::WORKER) {
+                RequestWorkerSteps();
+                return;
+            }
             DrawWorld();
-            world.UpdateEcology();
+            if (run_mode == RunMode::TIME_BUDGET) {
+                const double start = emscripten_get_now();
+                do {
+                    world.UpdateEcology();
+                } while (emscripten_get_now() - start < FRAME_BUDGET_MS);
+            } else {
+                for (size_t i = 0; i < steps_per_frame; i++) world.UpdateEcology();
+            }
+            // The world keeps its statistics current, so sampling them is free
+            const PopulationStats & stats = world.GetStats();
+            RecordPopulation(world.GetStep(), [&stats](int species) { return stats.GetCount(species); },
+                             [&stats](int species) { return stats.GetMeanEnergy(species); });
+        }
+
+        /**
+         * @brief Draw a snapshot posted back by the ecology worker
+         *
+         * If the pacing has left WORKER mode since the request, the animator's
+         * own world takes over from the snapshot instead.
+         * @param data WorkerReplyHeader followed by the worker's grid
+         * @param size Size of data in bytes
+         */
+        void ReceiveWorkerSnapshot(const char * data, int size) {
+            worker_busy = false;
+            if (size != static_cast<int>(sizeof(WorkerReplyHeader) + WorkerGridSize(world.GetSize()))) {
+                worker_synced = false;
+                return;
+            }
+            WorkerReplyHeader header;
+            std::memcpy(&header, data, sizeof(header));
+            RecordPopulation(header.step, [&header](int species) { return header.counts[species]; },
+                             [&header](int species) { return header.mean_energy[species]; });
+            const char * grid = data + sizeof(WorkerReplyHeader);
+            if (run_mode != RunMode::WORKER) {
+                LoadWorkerGrid(world, random_generator, grid, header.step);
+                worker_synced = false;
+                DrawWorld();
+            } else if (pixels.UpdateFromSpecies(GetWorkerGridSpecies(grid, world.GetSize()))) {
+                UploadPixels();
+            }
         }
 
     private:
+        /**
+         * @brief Read a whole-number setting from the page's query string
+         * @param name Parameter name, as in index.html?name=value
+         * @param fallback Value when the parameter is missing or not a number
+         * @param low Smallest value accepted
+         * @param high Largest value accepted
+         * @return The parameter clamped to [low, high], or fallback
+         */
+        static int GetPageSetting(const char * name, int fallback, int low, int high) {
+            const int value = EM_ASM_INT({
+                var value = parseInt(new URLSearchParams(window.location.search).get(UTF8ToString($0)), 10);
+                return isNaN(value) ? $1 : value;
+            }, name, fallback);
+            return std::max(low, std::min(value, high));
+        }
+
         /**
          * @brief Set up the web interface with instructions and controls
          */
@@ -85,68 +189,265 @@ class AEAnimator : public emp::web::Animate {
             doc << GetToggleButton("Toggle");
             doc << " ";
             doc << GetStepButton("Step");
+            doc << " ";
+            doc << emp::web::Button([this]() { ChangeSpeed(false); }, "Slower");
+            doc << " ";
+            doc << emp::web::Button([this]() { ChangeSpeed(true); }, "Faster");
+            doc << " ";
+            doc << emp::web::Button([this]() { NextRunMode(); }, "Pacing");
+            doc << " ";
+            doc << speed_text;
+            UpdateSpeedText();
+            doc << "<br>";
+            doc << chart;
+            doc << "<br>";
+            doc << stats_text;
         }
 
         /**
-         * @brief Initialize the world with organisms in a grid structure
+         * @brief Switch to the next pacing mode
+         *
+         * Steps per frame, then time budget, then worker, then back. The
+         * worker script is loaded the first time it is needed and restarted
+         * from this animator's world each time WORKER mode is entered.
          */
-        void InitializeWorld() {
-            world.SetPopStruct_Grid(NUM_W_BOXES, NUM_H_BOXES);
-            PopulateWithMice();
-            PopulateWithOwls();
+        void NextRunMode() {
+            switch (run_mode) {
+                case RunMode::STEPS_PER_FRAME: run_mode = RunMode::TIME_BUDGET; break;
+                case RunMode::TIME_BUDGET: run_mode = RunMode::WORKER; break;
+                case RunMode::WORKER: run_mode = RunMode::STEPS_PER_FRAME; break;
+            }
+            if (run_mode == RunMode::WORKER && !worker) worker = emscripten_create_worker("AEWorker.js");
+            UpdateSpeedText();
         }
 
         /**
-         * @brief Add mice to random positions in the world
+         * @brief Double or halve the number of steps per frame
+         * @param faster True to double, false to halve
          */
-        void PopulateWithMice() {
-            const int target_mice = NUM_W_BOXES * NUM_H_BOXES / MOUSE_DENSITY_RATIO;
-            for (int i = 0; i < target_mice; i++) {
-                size_t mouse_pos = random_generator.GetUInt(NUM_W_BOXES * NUM_H_BOXES);
-                if (!world.IsOccupied(mouse_pos)) {
-                    emp::Ptr<Mouse> new_mouse = new Mouse(&random_generator, INITIAL_MOUSE_ENERGY, 0);
-                    world.AddOrgAt(new_mouse, mouse_pos);
-                }
+        void ChangeSpeed(bool faster) {
+            if (faster) {
+                steps_per_frame = std::min(steps_per_frame * 2, MAX_STEPS_PER_FRAME);
+            } else {
+                steps_per_frame = std::max<size_t>(steps_per_frame / 2, 1);
             }
+            UpdateSpeedText();
         }
 
         /**
-         * @brief Add owls to random positions in the world
+         * @brief Show the current pacing next to the controls
          */
-        void PopulateWithOwls() {
-            const int target_owls = NUM_W_BOXES * NUM_H_BOXES / OWL_DENSITY_RATIO;
-            for (int i = 0; i < target_owls; i++) {
-                size_t owl_pos = random_generator.GetUInt(NUM_W_BOXES * NUM_H_BOXES);
-                if (!world.IsOccupied(owl_pos)) {
-                    emp::Ptr<Owl> new_owl = new Owl(&random_generator, INITIAL_OWL_ENERGY, 1);
-                    world.AddOrgAt(new_owl, owl_pos);
-                }
+        void UpdateSpeedText() {
+            speed_text.Clear();
+            if (run_mode == RunMode::TIME_BUDGET) {
+                speed_text << "Simulating for " << FRAME_BUDGET_MS << " ms per frame";
+            } else {
+                speed_text << steps_per_frame << (steps_per_frame == 1 ? " step" : " steps") << " per frame";
+                if (run_mode == RunMode::WORKER) speed_text << " in a worker";
             }
+            speed_text.Redraw();
+        }
+
+        /**
+         * @brief Add one sample to the population chart and redraw it
+         * @param step Completed steps
+         * @param count Gives the number of organisms of a species ID
+         * @param mean_energy Gives the mean energy of a species ID
+         */
+        template <typename COUNT, typename MEAN>
+        void RecordPopulation(uint64_t step, COUNT && count, MEAN && mean_energy) {
+            RegisteredSpecies::ForEach([&](auto tag) {
+                chart_counts.push_back(static_cast<uint32_t>(count(SpeciesTraits<typename decltype(tag)::type>::ID)));
+            });
+            if (chart_counts.size() > CHART_SAMPLES * RegisteredSpecies::SIZE) {
+                chart_counts.erase(chart_counts.begin(), chart_counts.begin() + RegisteredSpecies::SIZE);
+            }
+
+            stats_text.Clear();
+            stats_text << "Step " << step << ":";
+            RegisteredSpecies::ForEach([&](auto tag) {
+                using Traits = SpeciesTraits<typename decltype(tag)::type>;
+                stats_text << " " << count(Traits::ID) << " " << Traits::NAME
+                           << " (mean energy " << static_cast<int>(mean_energy(Traits::ID)) << ")";
+            });
+            stats_text.Redraw();
+            DrawChart();
+        }
+
+        /**
+         * @brief Draw each species' recent counts as a line in its own color
+         *
+         * The vertical scale is the largest count shown, so cycles stay
+         * visible on any grid size.
+         */
+        void DrawChart() {
+            const size_t samples = chart_counts.size() / RegisteredSpecies::SIZE;
+            uint32_t peak = 1;
+            for (uint32_t value : chart_counts) peak = std::max(peak, value);
+
+            EM_ASM({
+                var canvas = document.getElementById(UTF8ToString($0));
+                if (canvas) canvas.getContext('2d').clearRect(0, 0, canvas.width, canvas.height);
+            }, chart.GetID().c_str());
+            RegisteredSpecies::ForEach([&](auto tag) {
+                using Traits = SpeciesTraits<typename decltype(tag)::type>;
+                EM_ASM({
+                    var canvas = document.getElementById(UTF8ToString($0));
+                    if (!canvas || $4 < 2) return;
+                    var ctx = canvas.getContext('2d');
+                    ctx.strokeStyle = '#' + ('000000' + $1.toString(16)).slice(-6);
+                    ctx.lineWidth = 2;
+                    ctx.beginPath();
+                    for (var i = 0; i < $4; i++) {
+                        var value = HEAPU32[($2 >> 2) + i * $3 + $5];
+                        var x = i * canvas.width / ($6 - 1);
+                        var y = canvas.height - 1 - value * (canvas.height - 2) / $7;
+                        if (i == 0) ctx.moveTo(x, y);
+                        else ctx.lineTo(x, y);
+                    }
+                    ctx.stroke();
+                }, chart.GetID().c_str(), Traits::RGB, chart_counts.data(), RegisteredSpecies::SIZE,
+                   samples, Traits::ID, CHART_SAMPLES, peak);
+            });
+        }
+
+        /**
+         * @brief Ask the worker for the next snapshot unless one is on its way
+         *
+         * The first request after entering WORKER mode carries this
+         * animator's grid, so the worker continues from where it left off.
+         */
+        void RequestWorkerSteps() {
+            if (worker_busy) return;
+            worker_busy = true;
+            WorkerRequest request;
+            request.config = GetEcologyConfig();
+            request.seed = SEED;
+            request.steps = static_cast<uint32_t>(steps_per_frame);
+            request.restart = worker_synced ? 0 : 1;
+            request.step = world.GetStep();
+            worker_message.resize(sizeof(request));
+            std::memcpy(worker_message.data(), &request, sizeof(request));
+            if (!worker_synced) AppendWorkerGrid(world, worker_message);
+            worker_synced = true;
+            emscripten_call_worker(worker, "AdvanceWorld", worker_message.data(),
+                                   static_cast<int>(worker_message.size()), WorkerCallback, this);
+        }
+
+        /**
+         * @brief Route a worker reply back to its animator
+         * @param data Reply bytes
+         * @param size Size of data in bytes
+         * @param arg The AEAnimator that made the request
+         */
+        static void WorkerCallback(char * data, int size, void * arg) {
+            static_cast<AEAnimator *>(arg)->ReceiveWorkerSnapshot(data, size);
+        }
+
+        /**
+         * @brief Initialize the world with organisms in a grid structure
+         */
+        void InitializeWorld() {
+            world.SetPopStruct_Grid(num_w_boxes, num_h_boxes);
+            const EcologyConfig config = GetEcologyConfig();
+            PopulateWithMice(world, random_generator, config);
+            PopulateWithOwls(world, random_generator, config);
+        }
+
+        /**
+         * @brief Describe this animator's world and starting population
+         * @return Config shared with the headless batch runner's setup code
+         */
+        EcologyConfig GetEcologyConfig() const {
+            EcologyConfig config;
+            config.width = num_w_boxes;
+            config.height = num_h_boxes;
+            config.mouse_density_ratio = MOUSE_DENSITY_RATIO;
+            config.owl_density_ratio = OWL_DENSITY_RATIO;
+            config.initial_mouse_energy = INITIAL_MOUSE_ENERGY;
+            config.initial_owl_energy = INITIAL_OWL_ENERGY;
+            return config;
+        }
+
+        /**
+         * @brief Size the pixel buffer to the grid and load the palette
+         *
+         * Colors match the named CSS colors used by the rectangle path.
+         */
+        void SetupPixelBuffer() {
+            pixels.Resize(num_w_boxes, num_h_boxes);
+            pixels.SetColor(GridWorld::EMPTY, SpeciesPixelBuffer::RGBA(0, 128, 0)); // green
+            RegisteredSpecies::ForEach([this](auto tag) {
+                using Traits = SpeciesTraits<typename decltype(tag)::type>;
+                pixels.SetColor(Traits::ID, SpeciesPixelBuffer::RGBA(Traits::RGB >> 16, (Traits::RGB >> 8) & 0xFF,
+                                                                     Traits::RGB & 0xFF));
+            });
         }
 
         /**
          * @brief Render the current state of the world
          */
         void DrawWorld() {
+            if (USE_PIXEL_BUFFER) {
+                DrawPixels();
+                return;
+            }
             canvas.Clear();
             
-            for (int x = 0; x < NUM_W_BOXES; x++) {
-                for (int y = 0; y < NUM_H_BOXES; y++) {
-                    size_t pos = y * NUM_W_BOXES + x;
+            for (size_t x = 0; x < num_w_boxes; x++) {
+                for (size_t y = 0; y < num_h_boxes; y++) {
+                    size_t pos = y * num_w_boxes + x;
                     std::string color = GetCellColor(pos);
                     DrawCell(x, y, color);
                 }
             }
         }
 
+        /**
+         * @brief Repaint changed cells and upload them in one image
+         *
+         * Only the band of rows that changed since the last frame is copied to
+         * an offscreen canvas with one pixel per cell; that canvas is then
+         * scaled onto the visible one with smoothing off, so each cell shows
+         * as a solid rect_side square. The offscreen canvas keeps earlier
+         * frames, so unchanged rows are never re-sent.
+         */
+        void DrawPixels() {
+            if (pixels.Update(world)) UploadPixels();
+        }
+
+        /**
+         * @brief Copy the pixel buffer's dirty rows to the canvas
+         */
+        void UploadPixels() {
+            EM_ASM({
+                var canvas = document.getElementById(UTF8ToString($0));
+                if (!canvas) return;
+                var cache = Module.aePixelCanvas;
+                if (!cache || cache.width != $2 || cache.height != $3) {
+                    cache = document.createElement('canvas');
+                    cache.width = $2;
+                    cache.height = $3;
+                    Module.aePixelCanvas = cache;
+                }
+                var rows = $5 - $4;
+                var bytes = new Uint8ClampedArray(HEAPU8.buffer, $1 + $4 * $2 * 4, rows * $2 * 4);
+                cache.getContext('2d').putImageData(new ImageData(bytes, $2, rows), 0, $4);
+                var ctx = canvas.getContext('2d');
+                ctx.imageSmoothingEnabled = false;
+                ctx.drawImage(cache, 0, 0, canvas.width, canvas.height);
+            }, canvas.GetID().c_str(), pixels.GetPixels(), pixels.GetWidth(), pixels.GetHeight(),
+               pixels.GetDirtyBegin(), pixels.GetDirtyEnd());
+        }
+
         /**
          * @brief Draw a single cell on the canvas
          * @param x X coordinate in grid
          * @param y Y coordinate in grid
          * @param color Fill color for the cell
          */
-        void DrawCell(int x, int y, const std::string& color) {
-            canvas.Rect(x * RECT_SIDE, y * RECT_SIDE, RECT_SIDE, RECT_SIDE, color, "black");
+        void DrawCell(size_t x, size_t y, const std::string& color) {
+            canvas.Rect(x * rect_side, y * rect_side, rect_side, rect_side, color, "black");
         }
 
         /**
@@ -159,8 +460,11 @@ class AEAnimator : public emp::web::Animate {
                 return grass_color;
             }
             
-            int species = world.GetOrg(pos).GetSpecies();
-            return (species == 0) ? mouse_color : owl_color;
+            std::string color = grass_color;
+            RegisteredSpecies::Dispatch(world.GetOrg(pos).GetSpecies(), [&color](auto tag) {
+                color = SpeciesTraits<typename decltype(tag)::type>::COLOR;
+            });
+            return color;
         }
 };
 
@@ -0,0 +1,57 @@
+#include "emp/base/Ptr.hpp"
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+#include <cstring>
+#include <emscripten.h>
+#include "World.h"
+#include "Setup.h"
+#include "WorkerProtocol.h"
+
+// Ecology state owned by the worker; built by the first (restart) request
+emp::Ptr<emp::Random> random_generator = nullptr;
+emp::Ptr<OrgWorld> world = nullptr;
+emp::vector<char> reply;
+
+/**
+ * @brief Advance the worker's world and reply with a species snapshot
+ *
+ * Called from the animator through emscripten_call_worker. Runs the
+ * requested number of steps off the UI thread, then responds with a
+ * WorkerReplyHeader followed by the worker's grid.
+ * @param data Bytes of a WorkerRequest, then the animator's grid if it is a restart
+ * @param size Size of data in bytes
+ */
+extern "C" EMSCRIPTEN_KEEPALIVE void AdvanceWorld(char * data, int size) {
+    WorkerRequest request;
+    if (size < static_cast<int>(sizeof(WorkerRequest))) {
+        emscripten_worker_respond(nullptr, 0);
+        return;
+    }
+    std::memcpy(&request, data, sizeof(request));
+    const size_t num_cells = request.config.width * request.config.height;
+    const size_t grid_size = request.restart ? WorkerGridSize(num_cells) : 0;
+    if (static_cast<size_t>(size) != sizeof(WorkerRequest) + grid_size || (!world && !request.restart)) {
+        emscripten_worker_respond(nullptr, 0);
+        return;
+    }
+
+    if (!world) {
+        random_generator = emp::NewPtr<emp::Random>(static_cast<int>(request.seed));
+        world = emp::NewPtr<OrgWorld>(*random_generator);
+        world->SetPopStruct_Grid(request.config.width, request.config.height);
+    }
+    if (request.restart) LoadWorkerGrid(*world, *random_generator, data + sizeof(WorkerRequest), request.step);
+    for (uint32_t i = 0; i < request.steps; i++) world->UpdateEcology();
+
+    WorkerReplyHeader header;
+    header.step = world->GetStep();
+    header.num_orgs = world->GetNumOrgs();
+    for (size_t species = 0; species < PopulationStats::MAX_SPECIES; species++) {
+        header.counts[species] = world->GetStats().GetCount(species);
+        header.mean_energy[species] = world->GetStats().GetMeanEnergy(species);
+    }
+    reply.resize(sizeof(header));
+    std::memcpy(reply.data(), &header, sizeof(header));
+    AppendWorkerGrid(*world, reply);
+    emscripten_worker_respond(reply.data(), static_cast<int>(reply.size()));
+}
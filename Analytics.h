@@ -0,0 +1,421 @@
+#ifndef ANALYTICS_H
+#define ANALYTICS_H
+
+#include "emp/base/vector.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "BoundedQueue.h"
+#include "Setup.h"
+#include "ThreadPool.h"
+
+/**
+ * @brief Species byte of every cell of a world at one step
+ *
+ * Copied out of the world so it can be analyzed while the simulation
+ * moves on.
+ */
+struct SpatialSnapshot {
+    int seed = 0;                  ///< Replicate the grid came from
+    uint64_t step = 0;             ///< Step the grid was taken at
+    size_t width = 0;              ///< Grid width in cells
+    size_t height = 0;             ///< Grid height in cells
+    emp::vector<uint8_t> species;  ///< Species ID of every cell, GridWorld::EMPTY for grass
+
+    /**
+     * @brief Copy a world's grid
+     * @param world OrgWorld, GridWorld or any world GetCellSpecies accepts
+     * @param _seed Replicate the world belongs to
+     */
+    template <typename WORLD>
+    void Capture(const WORLD & world, int _seed) {
+        seed = _seed;
+        step = world.GetStep();
+        width = world.GetWidth();
+        height = world.GetHeight();
+        species.resize(width * height);
+        for (size_t i = 0; i < species.size(); i++) species[i] = GetCellSpecies(world, i);
+    }
+};
+
+/**
+ * @brief Sizes of the connected patches of one cell type
+ */
+struct ClusterStats {
+    emp::vector<size_t> sizes;  ///< Cells in each patch, largest first
+
+    /**
+     * @brief Get the number of patches
+     * @return Patch count
+     */
+    size_t GetCount() const { return sizes.size(); }
+
+    /**
+     * @brief Get the size of the largest patch
+     * @return Cells in it (0 when there are none)
+     */
+    size_t GetLargest() const { return sizes.empty() ? 0 : sizes[0]; }
+
+    /**
+     * @brief Get the mean patch size
+     * @return Cells per patch (0 when there are none)
+     */
+    double GetMean() const {
+        size_t cells = 0;
+        for (size_t size : sizes) cells += size;
+        return sizes.empty() ? 0.0 : static_cast<double>(cells) / sizes.size();
+    }
+};
+
+/**
+ * @brief Spatial metrics of one snapshot
+ */
+struct SpatialSummary {
+    int seed = 0;                 ///< Replicate the snapshot came from
+    uint64_t step = 0;            ///< Step the snapshot was taken at
+    ClusterStats mice;            ///< Connected groups of mice
+    ClusterStats grass;           ///< Connected patches of grass
+    emp::vector<double> owl_mouse; ///< Owl-mouse pair correlation at distance 1, 2, ...
+};
+
+/**
+ * @brief Cluster and pair-correlation measurements on grid snapshots
+ *
+ * Cells are neighbors under the same wrapped 8-cell neighborhood the
+ * ecology uses, and distances are wrapped Chebyshev distances, so ring r
+ * holds the cells exactly r moves away. Work is split into row strips run
+ * on the given pool.
+ */
+class SpatialAnalysis {
+    public:
+        static constexpr size_t STRIPS_PER_THREAD = 4; ///< Row strips per pool thread, for load balance
+
+        /**
+         * @brief Find the connected patches of one cell type
+         *
+         * Each strip of rows is joined by a union-find of its own in
+         * parallel, then the few links crossing strip boundaries are joined
+         * serially and every cell is labeled with its root in parallel.
+         * @param snapshot Grid to measure
+         * @param species Cell type to group (GridWorld::EMPTY for grass)
+         * @param pool Threads to use
+         * @return Size of every patch
+         */
+        static ClusterStats FindClusters(const SpatialSnapshot & snapshot, uint8_t species, ThreadPool & pool) {
+            const size_t width = snapshot.width;
+            const size_t height = snapshot.height;
+            const size_t size = width * height;
+            const emp::vector<uint8_t> & grid = snapshot.species;
+            emp::vector<size_t> parent(size);
+            const size_t strip_rows = GetStripRows(height, pool);
+            const size_t num_strips = (height + strip_rows - 1) / strip_rows;
+
+            // Every adjacent pair is linked once, from its lower or right cell
+            auto link_above = [&](size_t x, size_t y, size_t above) {
+                const size_t i = y * width + x;
+                const size_t row = above * width;
+                const size_t west = (x + width - 1) % width;
+                const size_t east = (x + 1) % width;
+                if (grid[row + west] == species) Unite(parent, i, row + west);
+                if (grid[row + x] == species) Unite(parent, i, row + x);
+                if (grid[row + east] == species) Unite(parent, i, row + east);
+            };
+
+            pool.ParallelFor(num_strips, [&](size_t strip) {
+                const size_t begin = strip * strip_rows;
+                const size_t end = std::min(begin + strip_rows, height);
+                for (size_t i = begin * width; i < end * width; i++) parent[i] = i;
+                for (size_t y = begin; y < end; y++) {
+                    const size_t above = (y + height - 1) % height;
+                    const bool above_inside = above >= begin && above < end;
+                    for (size_t x = 0; x < width; x++) {
+                        const size_t i = y * width + x;
+                        if (grid[i] != species) continue;
+                        const size_t west = i - x + (x + width - 1) % width;
+                        const bool west_same = grid[west] == species;
+                        if (x == 0 || y == begin) {
+                            // Neighbors not yet scanned are all linked
+                            if (west_same) Unite(parent, i, west);
+                            if (above_inside) link_above(x, y, above);
+                            continue;
+                        }
+                        // Every neighbor linked here has been scanned, so its links
+                        // already join it to the others it touches: the north cell
+                        // touches the other three, and the west cell the north-west one
+                        const size_t row = above * width;
+                        if (grid[row + x] == species) {
+                            Unite(parent, i, row + x);
+                            continue;
+                        }
+                        if (west_same) Unite(parent, i, west);
+                        else if (grid[row + x - 1] == species) Unite(parent, i, row + x - 1);
+                        const size_t east = row + (x + 1) % width;
+                        if (grid[east] == species) Unite(parent, i, east);
+                    }
+                }
+            });
+
+            // Links from each strip's first row to the row above it belong to no strip
+            for (size_t strip = 0; strip < num_strips; strip++) {
+                const size_t begin = strip * strip_rows;
+                const size_t above = (begin + height - 1) % height;
+                if (above >= begin && above < std::min(begin + strip_rows, height)) continue;
+                for (size_t x = 0; x < width; x++) {
+                    if (grid[begin * width + x] == species) link_above(x, begin, above);
+                }
+            }
+
+            emp::vector<size_t> roots(size);
+            pool.ParallelFor(num_strips, [&](size_t strip) {
+                const size_t begin = strip * strip_rows * width;
+                const size_t end = std::min(begin + strip_rows * width, size);
+                for (size_t i = begin; i < end; i++) {
+                    if (grid[i] != species) continue;
+                    size_t root = i;
+                    while (parent[root] != root) root = parent[root];
+                    roots[i] = root;
+                }
+            });
+
+            // A patch's root is one of its own cells, so counts can reuse parent
+            std::fill(parent.begin(), parent.end(), 0);
+            for (size_t i = 0; i < size; i++) {
+                if (grid[i] == species) parent[roots[i]]++;
+            }
+            ClusterStats stats;
+            for (size_t count : parent) {
+                if (count > 0) stats.sizes.push_back(count);
+            }
+            std::sort(stats.sizes.begin(), stats.sizes.end(), std::greater<size_t>());
+            return stats;
+        }
+
+        /**
+         * @brief Measure how much more often target cells sit at each distance
+         *        from source cells than if targets were spread uniformly
+         *
+         * Pairs are counted by scanning the (2 * max_distance + 1)-wide block
+         * around every source cell, in parallel over row blocks of sources.
+         * Each ring's count is divided by what a uniform density of targets
+         * would give, so 1 means no correlation. Distances whose ring would
+         * wrap onto itself on a small grid count each cell once.
+         * @param snapshot Grid to measure
+         * @param source Species at the center of each ring
+         * @param target Species counted in the rings (may equal source)
+         * @param max_distance Largest distance measured
+         * @param pool Threads to use
+         * @return Correlation at distance 1 to max_distance (0 where nothing can be measured)
+         */
+        static emp::vector<double> PairCorrelation(const SpatialSnapshot & snapshot, uint8_t source, uint8_t target,
+                                                   size_t max_distance, ThreadPool & pool) {
+            const size_t width = snapshot.width;
+            const size_t height = snapshot.height;
+            const emp::vector<uint8_t> & grid = snapshot.species;
+            emp::vector<double> correlation(max_distance, 0.0);
+            if (max_distance == 0 || grid.empty()) return correlation;
+
+            // Offsets run over distinct wrapped cells only: on an even side the
+            // cell half-way round is reached from one direction, not both
+            const long reach_x = static_cast<long>(std::min(max_distance, width / 2));
+            const long reach_y = static_cast<long>(std::min(max_distance, height / 2));
+            const long back_x = static_cast<long>(std::min(max_distance, (width - 1) / 2));
+            const long back_y = static_cast<long>(std::min(max_distance, (height - 1) / 2));
+            emp::vector<size_t> ring_cells(max_distance + 1, 0);
+            for (long dy = -back_y; dy <= reach_y; dy++) {
+                for (long dx = -back_x; dx <= reach_x; dx++) ring_cells[std::max(std::labs(dx), std::labs(dy))]++;
+            }
+
+            // Wrapped column of x + dx for x + dx in [-back_x, width + reach_x)
+            emp::vector<size_t> column(width + back_x + reach_x);
+            for (size_t k = 0; k < column.size(); k++) column[k] = (k + width - back_x) % width;
+
+            const size_t strip_rows = GetStripRows(height, pool);
+            const size_t num_strips = (height + strip_rows - 1) / strip_rows;
+            emp::vector<emp::vector<size_t>> strip_pairs(num_strips, emp::vector<size_t>(max_distance + 1, 0));
+            emp::vector<size_t> strip_sources(num_strips, 0);
+            emp::vector<size_t> strip_targets(num_strips, 0);
+            pool.ParallelFor(num_strips, [&](size_t strip) {
+                emp::vector<size_t> & pairs = strip_pairs[strip];
+                const size_t begin = strip * strip_rows;
+                const size_t end = std::min(begin + strip_rows, height);
+                for (size_t y = begin; y < end; y++) {
+                    for (size_t x = 0; x < width; x++) {
+                        const uint8_t here = grid[y * width + x];
+                        if (here == target) strip_targets[strip]++;
+                        if (here != source) continue;
+                        strip_sources[strip]++;
+                        // Away from the side edges the window's rows are contiguous
+                        const bool wraps = x < static_cast<size_t>(back_x) || x + reach_x >= width;
+                        for (long dy = -back_y; dy <= reach_y; dy++) {
+                            const size_t row = ((y + height + dy) % height) * width;
+                            const size_t ring_y = static_cast<size_t>(std::labs(dy));
+                            const uint8_t * cells = grid.data() + row + x;
+                            for (long dx = -back_x; dx <= reach_x; dx++) {
+                                const uint8_t cell = wraps ? grid[row + column[x + back_x + dx]] : cells[dx];
+                                if (cell != target) continue;
+                                pairs[std::max(ring_y, static_cast<size_t>(std::labs(dx)))]++;
+                            }
+                        }
+                    }
+                }
+            });
+
+            emp::vector<size_t> pairs(max_distance + 1, 0);
+            size_t sources = 0, targets = 0;
+            for (size_t strip = 0; strip < num_strips; strip++) {
+                for (size_t r = 0; r <= max_distance; r++) pairs[r] += strip_pairs[strip][r];
+                sources += strip_sources[strip];
+                targets += strip_targets[strip];
+            }
+
+            // A cell never pairs with itself, so a species paired with itself
+            // sees one fewer target among one fewer other cells
+            const size_t cells = grid.size();
+            const bool self = source == target;
+            if (sources == 0 || targets <= (self ? 1u : 0u) || cells <= 1) return correlation;
+            const double density = self ? static_cast<double>(targets - 1) / (cells - 1)
+                                        : static_cast<double>(targets) / cells;
+            for (size_t r = 1; r <= max_distance; r++) {
+                if (ring_cells[r] == 0) continue;
+                correlation[r - 1] = pairs[r] / (sources * density * ring_cells[r]);
+            }
+            return correlation;
+        }
+
+        /**
+         * @brief Take every measurement ae_lab reports
+         * @param snapshot Grid to measure
+         * @param max_distance Largest owl-mouse distance measured
+         * @param pool Threads to use
+         * @return Mouse clusters, grass patches and owl-mouse correlation
+         */
+        static SpatialSummary Summarize(const SpatialSnapshot & snapshot, size_t max_distance, ThreadPool & pool) {
+            SpatialSummary summary;
+            summary.seed = snapshot.seed;
+            summary.step = snapshot.step;
+            summary.mice = FindClusters(snapshot, Mouse::SPECIES_ID, pool);
+            summary.grass = FindClusters(snapshot, GridWorld::EMPTY, pool);
+            summary.owl_mouse = PairCorrelation(snapshot, Owl::SPECIES_ID, Mouse::SPECIES_ID, max_distance, pool);
+            return summary;
+        }
+
+    private:
+        /**
+         * @brief Get the rows in each strip of a parallel pass
+         * @param height Grid height in cells
+         * @param pool Threads the pass runs on
+         * @return Rows per strip (at least 1)
+         */
+        static size_t GetStripRows(size_t height, const ThreadPool & pool) {
+            const size_t strips = pool.GetNumThreads() * STRIPS_PER_THREAD;
+            return std::max<size_t>(1, (height + strips - 1) / strips);
+        }
+
+        /**
+         * @brief Find a cell's root, halving the path on the way
+         * @param parent Union-find parents
+         * @param i Cell index
+         * @return Root of the cell's set
+         */
+        static size_t Find(emp::vector<size_t> & parent, size_t i) {
+            while (parent[i] != i) {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+            return i;
+        }
+
+        /**
+         * @brief Join the sets of two cells under the lower-indexed root
+         * @param parent Union-find parents
+         * @param a First cell
+         * @param b Second cell
+         */
+        static void Unite(emp::vector<size_t> & parent, size_t a, size_t b) {
+            a = Find(parent, a);
+            b = Find(parent, b);
+            if (a == b) return;
+            if (a < b) parent[b] = a;
+            else parent[a] = b;
+        }
+};
+
+/**
+ * @brief Runs SpatialAnalysis on snapshots in a background thread
+ *
+ * Capture copies the grid and returns, so the simulation keeps stepping
+ * while earlier snapshots are measured. Results are handed to the sink on
+ * the analysis thread, in capture order. The queue is bounded, so a
+ * simulation that outruns the analysis waits instead of piling up grids.
+ */
+class SpatialAnalyzer {
+    public:
+        using Sink = std::function<void(const SpatialSummary &)>; ///< Receives each result
+
+    private:
+        size_t max_distance;                   ///< Largest owl-mouse distance measured
+        ThreadPool pool;                       ///< Threads the analysis thread splits each snapshot over
+        Sink sink;                             ///< Destination for results
+        BoundedQueue<SpatialSnapshot> queue;   ///< Snapshots waiting for analysis
+        std::thread thread;                    ///< Analysis thread
+        bool closed = false;                   ///< Set once Close has run
+
+    public:
+        /**
+         * @brief Start the analysis thread
+         * @param _sink Destination for results (called on the analysis thread)
+         * @param _max_distance Largest owl-mouse distance measured
+         * @param threads Threads to split each snapshot over, including the analysis thread
+         * @param queue_capacity Snapshots held in memory before Capture waits
+         */
+        SpatialAnalyzer(Sink _sink, size_t _max_distance=8, size_t threads=1, size_t queue_capacity=4) :
+            max_distance(_max_distance), pool(threads > 0 ? threads : 1), sink(std::move(_sink)),
+            queue(queue_capacity) {
+            thread = std::thread([this] { AnalysisLoop(); });
+        }
+
+        SpatialAnalyzer(const SpatialAnalyzer &) = delete;
+        SpatialAnalyzer & operator=(const SpatialAnalyzer &) = delete;
+
+        /**
+         * @brief Finish the queued snapshots and stop the thread
+         */
+        ~SpatialAnalyzer() { Close(); }
+
+        /**
+         * @brief Queue a copy of a world's grid for analysis
+         * @param world OrgWorld, GridWorld or any world GetCellSpecies accepts
+         * @param seed Replicate the world belongs to
+         */
+        template <typename WORLD>
+        void Capture(const WORLD & world, int seed) {
+            SpatialSnapshot snapshot;
+            snapshot.Capture(world, seed);
+            queue.Push(std::move(snapshot));
+        }
+
+        /**
+         * @brief Analyze every queued snapshot, then stop the thread
+         */
+        void Close() {
+            if (closed) return;
+            closed = true;
+            queue.Close();
+            if (thread.joinable()) thread.join();
+        }
+
+    private:
+        /**
+         * @brief Analyze snapshots until the queue closes
+         */
+        void AnalysisLoop() {
+            SpatialSnapshot snapshot;
+            while (queue.Pop(snapshot)) sink(SpatialAnalysis::Summarize(snapshot, max_distance, pool));
+        }
+};
+
+#endif
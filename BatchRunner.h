@@ -0,0 +1,874 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "Analytics.h"
+#include "Checkpoint.h"
+#include "Detectors.h"
+#include "Distributed.h"
+#include "Setup.h"
+#include "TrajectoryRecorder.h"
+#include "WorkStealingScheduler.h"
+
+/**
+ * @brief Everything needed to run a batch of replicates
+ */
+class BatchConfig {
+    public:
+        EcologyConfig ecology;        ///< Grid size and starting population
+        size_t steps = 1000;          ///< UpdateEcology calls per replicate
+        int first_seed = 1;           ///< First seed in the sweep
+        int last_seed = 1;            ///< Last seed in the sweep (inclusive)
+        size_t threads = 0;           ///< Worker threads (0 = all cores)
+        std::string engine = "org";   ///< "org" (OrgWorld), "grid" (GridWorld), "chunked" (ChunkedWorld), "ensemble" (EnsembleWorld lanes)
+                                      ///< or "distributed" (strips across worker processes)
+        size_t processes = 2;         ///< Worker processes per seed with the distributed engine
+        std::string schedule = "full"; ///< Scheduling: "full" (reference order), "active" (OrgWorld, occupied cells only) or "block" (GridWorld, block by block)
+        std::string random = "stream"; ///< OrgWorld random source: "stream" (reference) or "counter" (keyed per cell)
+        std::string move = "sequential"; ///< OrgWorld movement: "sequential" (reference) or "two-phase" (propose, then apply)
+        std::string update = "asynchronous"; ///< OrgWorld update: "asynchronous" (reference) or "synchronous" (double-buffered)
+        size_t world_threads = 1;     ///< Threads each OrgWorld replicate's update is tiled across
+        std::string format = "csv";   ///< "csv" or "binary"
+        std::string output = "-";     ///< Output path ("-" for stdout)
+        size_t checkpoint_every = 0;  ///< Steps between checkpoints (0 = never)
+        std::string checkpoint_prefix = "checkpoint"; ///< Checkpoints go to <prefix>-<seed>-<step>.aecp
+        std::string resume;           ///< Checkpoint every replicate continues exactly (empty = populate)
+        std::string fork;             ///< Checkpoint every replicate starts from, reseeded with its seed
+        size_t record_every = 0;      ///< Steps between recorded trajectory frames (0 = no recording)
+        std::string record_prefix = "trajectory"; ///< Trajectories go to <prefix>-<seed>.aetr
+        size_t analyze_every = 0;     ///< Steps between spatial analyses (0 = no analysis)
+        size_t analysis_distance = 8; ///< Largest owl-mouse distance in the pair correlation
+        size_t analysis_threads = 1;  ///< Threads each replicate's analysis thread splits a grid over
+        std::string on_absorbing = "run";  ///< Action once the world is empty: "run", "stop" or "fast-forward"
+        std::string on_extinction = "run"; ///< Action once a species dies out
+        std::string on_steady = "run";     ///< Action once species counts are stationary
+        size_t steady_window = 500;        ///< Steps per window of the steady-state test
+        double steady_tolerance = 0.25;    ///< Largest shift in mean count between windows, in standard deviations
+        bool help = false;                 ///< Set by --help: print the usage text instead of running
+
+        /**
+         * @brief Apply one setting by name
+         * @param key Setting name (same as the command-line flag without "--")
+         * @param value Setting value
+         * @return False if the key is unknown or the value is malformed
+         */
+        bool Set(const std::string & key, const std::string & value) {
+            if (key == "width") ecology.width = ParseCount(value);
+            else if (key == "height") ecology.height = ParseCount(value);
+            else if (key == "mouse-ratio") ecology.mouse_density_ratio = std::stoi(value);
+            else if (key == "owl-ratio") ecology.owl_density_ratio = std::stoi(value);
+            else if (key == "mouse-energy") ecology.initial_mouse_energy = std::stod(value);
+            else if (key == "owl-energy") ecology.initial_owl_energy = std::stod(value);
+            else if (key == "steps") steps = ParseCount(value);
+            else if (key == "threads") threads = ParseCount(value);
+            else if (key == "processes") processes = ParseCount(value);
+            else if (key == "engine") engine = value;
+            else if (key == "schedule") schedule = value;
+            else if (key == "random") random = value;
+            else if (key == "move") move = value;
+            else if (key == "update") update = value;
+            else if (key == "world-threads") world_threads = ParseCount(value);
+            else if (key == "format") format = value;
+            else if (key == "out") output = value;
+            else if (key == "checkpoint-every") checkpoint_every = ParseCount(value);
+            else if (key == "checkpoint-prefix") checkpoint_prefix = value;
+            else if (key == "resume") resume = value;
+            else if (key == "fork") fork = value;
+            else if (key == "record-every") record_every = ParseCount(value);
+            else if (key == "record-prefix") record_prefix = value;
+            else if (key == "analyze-every") analyze_every = ParseCount(value);
+            else if (key == "analysis-distance") analysis_distance = ParseCount(value);
+            else if (key == "analysis-threads") analysis_threads = ParseCount(value);
+            else if (key == "on-absorbing") on_absorbing = value;
+            else if (key == "on-extinction") on_extinction = value;
+            else if (key == "on-steady") on_steady = value;
+            else if (key == "steady-window") steady_window = ParseCount(value);
+            else if (key == "steady-tolerance") steady_tolerance = std::stod(value);
+            else if (key == "seeds") {
+                // Either a single seed or an inclusive range "first:last"
+                const size_t colon = value.find(':');
+                first_seed = std::stoi(value.substr(0, colon));
+                last_seed = colon == std::string::npos ? first_seed : std::stoi(value.substr(colon + 1));
+            }
+            else return false;
+            return true;
+        }
+
+        /**
+         * @brief Load settings from a file of "key = value" lines
+         *
+         * Blank lines and lines starting with '#' are ignored.
+         * @param path File to read
+         * @param error Set to a description of the first problem found
+         * @return False if the file could not be read or contains a bad setting
+         */
+        bool LoadFile(const std::string & path, std::string & error) {
+            std::ifstream file(path);
+            if (!file) {
+                error = "cannot open config file " + path;
+                return false;
+            }
+            std::string line;
+            while (std::getline(file, line)) {
+                const size_t start = line.find_first_not_of(" \t");
+                if (start == std::string::npos || line[start] == '#') continue;
+                const size_t eq = line.find('=');
+                if (eq == std::string::npos) {
+                    error = "expected key = value: " + line;
+                    return false;
+                }
+                if (!SetChecked(Trim(line.substr(0, eq)), Trim(line.substr(eq + 1)), error)) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Apply command-line flags of the form "--key value"
+         *
+         * "--config path" loads a file at that point, so later flags override it.
+         * "--help" stops parsing and sets help.
+         * @param argc Argument count
+         * @param argv Argument values
+         * @param error Set to a description of the first problem found
+         * @return False on an unknown flag, a missing value or a bad setting
+         */
+        bool ParseArgs(int argc, char* argv[], std::string & error) {
+            for (int i = 1; i < argc; i++) {
+                const std::string flag = argv[i];
+                if (flag == "--help") {
+                    help = true;
+                    return true;
+                }
+                if (flag.rfind("--", 0) != 0 || i + 1 >= argc) {
+                    error = "expected --key value, got " + flag;
+                    return false;
+                }
+                const std::string key = flag.substr(2);
+                const std::string value = argv[++i];
+                if (key == "config") {
+                    if (!LoadFile(value, error)) return false;
+                } else if (!SetChecked(key, value, error)) {
+                    return false;
+                }
+            }
+            if (engine != "org" && engine != "grid" && engine != "chunked" && engine != "ensemble"
+                && engine != "distributed") {
+                error = "engine must be org, grid, chunked, ensemble or distributed";
+                return false;
+            }
+            if (engine == "ensemble" && (checkpoint_every > 0 || !resume.empty() || !fork.empty())) {
+                error = "engine ensemble does not support checkpoints";
+                return false;
+            }
+            if (engine == "distributed") {
+                if (random != "counter") {
+                    error = "engine distributed requires random counter";
+                    return false;
+                }
+                if (checkpoint_every > 0 || !resume.empty() || !fork.empty() || record_every > 0) {
+                    error = "engine distributed does not support checkpoints or recording";
+                    return false;
+                }
+                if (move != "sequential" || update != "asynchronous") {
+                    error = "engine distributed requires move sequential and update asynchronous";
+                    return false;
+                }
+                if (analyze_every > 0) {
+                    error = "engine distributed does not support analysis";
+                    return false;
+                }
+                if (on_absorbing != "run" || on_extinction != "run" || on_steady != "run") {
+                    error = "engine distributed does not support detectors";
+                    return false;
+                }
+            }
+            if (!NeighborStencil::Supports(ecology.width, ecology.height)) {
+                error = "width and height must be at least " + std::to_string(NeighborStencil::MIN_SIDE)
+                    + " with fewer than 2^32 cells";
+                return false;
+            }
+            if (ecology.mouse_density_ratio <= 0 || ecology.owl_density_ratio <= 0) {
+                error = "mouse-ratio and owl-ratio must be at least 1";
+                return false;
+            }
+            DetectorAction action;
+            if (!ParseDetectorAction(on_absorbing, action) || !ParseDetectorAction(on_extinction, action)
+                || !ParseDetectorAction(on_steady, action)) {
+                error = "on-absorbing, on-extinction and on-steady must be run, stop or fast-forward";
+                return false;
+            }
+            if (steady_window == 0) {
+                error = "steady-window must be at least 1";
+                return false;
+            }
+            if (analyze_every > 0 && format != "csv") {
+                error = "analysis requires format csv";
+                return false;
+            }
+            if (schedule != "full" && schedule != "active" && schedule != "block") {
+                error = "schedule must be full, active or block";
+                return false;
+            }
+            if (schedule == "block" && engine != "grid") {
+                error = "schedule block requires engine grid";
+                return false;
+            }
+            if (schedule == "active" && engine != "org") {
+                error = "schedule active requires engine org";
+                return false;
+            }
+            if (random != "stream" && random != "counter") {
+                error = "random must be stream or counter";
+                return false;
+            }
+            if (random == "counter" && engine != "org" && engine != "distributed") {
+                error = "random counter requires engine org or distributed";
+                return false;
+            }
+            if (move != "sequential" && move != "two-phase") {
+                error = "move must be sequential or two-phase";
+                return false;
+            }
+            if (move == "two-phase" && engine != "org") {
+                error = "move two-phase requires engine org";
+                return false;
+            }
+            if (update != "asynchronous" && update != "synchronous") {
+                error = "update must be asynchronous or synchronous";
+                return false;
+            }
+            if (update == "synchronous" && engine != "org") {
+                error = "update synchronous requires engine org";
+                return false;
+            }
+            if (world_threads == 0) {
+                error = "world-threads must be at least 1";
+                return false;
+            }
+            if (world_threads > 1 && engine != "org") {
+                error = "world-threads requires engine org";
+                return false;
+            }
+            if (format != "csv" && format != "binary") {
+                error = "format must be csv or binary";
+                return false;
+            }
+            if (!resume.empty() && !fork.empty()) {
+                error = "resume and fork cannot both be set";
+                return false;
+            }
+            if (last_seed < first_seed || first_seed <= 0) {
+                error = "seeds must be a positive range first:last";
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        /**
+         * @brief Set a key, turning parse failures into an error message
+         * @param key Setting name
+         * @param value Setting value
+         * @param error Set on failure
+         * @return True on success
+         */
+        bool SetChecked(const std::string & key, const std::string & value, std::string & error) {
+            try {
+                if (Set(key, value)) return true;
+                error = "unknown setting " + key;
+            } catch (const std::exception &) {
+                error = "bad value for " + key + ": " + value;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Parse a count, rejecting negative values
+         *
+         * std::stoul accepts "-1" and wraps it to the largest size_t, so
+         * counts are parsed signed and checked instead.
+         * @param value Whole number with no other text
+         * @return The count
+         * @throws std::invalid_argument if value is negative or not a whole number
+         */
+        static size_t ParseCount(const std::string & value) {
+            size_t used = 0;
+            const long long count = std::stoll(value, &used);
+            if (count < 0 || used != value.size()) throw std::invalid_argument("bad count " + value);
+            return static_cast<size_t>(count);
+        }
+
+        /**
+         * @brief Strip surrounding whitespace
+         * @param in Text to trim
+         * @return Trimmed copy
+         */
+        static std::string Trim(const std::string & in) {
+            const size_t start = in.find_first_not_of(" \t\r");
+            if (start == std::string::npos) return "";
+            const size_t end = in.find_last_not_of(" \t\r");
+            return in.substr(start, end - start + 1);
+        }
+};
+
+/**
+ * @brief Population summary of one replicate after one step
+ */
+struct StepSummary {
+    uint32_t seed;   ///< Replicate seed
+    uint32_t step;   ///< Step number (0 = initial population)
+    uint32_t mice;   ///< Number of mice
+    uint32_t owls;   ///< Number of owls
+};
+
+/**
+ * @brief Thread-safe sink for per-step summaries
+ *
+ * CSV output has a "seed,step,mice,owls" header. Binary output starts with
+ * the magic "AEPS", a uint32 version and a uint32 record size, followed by
+ * packed StepSummary records in native byte order. Replicates hand over
+ * blocks of rows, so rows from different seeds may interleave by block.
+ *
+ * CSV output can also carry spatial analysis rows, which start with the
+ * word "spatial" and have a header row of their own, so readers can split
+ * the two series on the first field.
+ */
+class SummaryWriter {
+    private:
+        static constexpr uint32_t BINARY_VERSION = 1; ///< Binary format version
+
+        std::mutex mutex;           ///< Serializes writes from worker threads
+        std::ofstream file;         ///< Output file (unused when writing to stdout)
+        std::ostream *out;          ///< Destination stream
+        bool binary;                ///< True for the binary record format
+
+    public:
+        /**
+         * @brief Open the output and write its header
+         * @param path Output path ("-" for stdout)
+         * @param format "csv" or "binary"
+         * @param spatial_distance Owl-mouse distances in each spatial row (0 = no spatial rows, CSV only)
+         */
+        SummaryWriter(const std::string & path, const std::string & format, size_t spatial_distance=0) :
+            binary(format == "binary") {
+            if (path == "-") {
+                out = &std::cout;
+            } else {
+                file.open(path, binary ? std::ios::binary : std::ios::out);
+                out = &file;
+            }
+
+            if (binary) {
+                const uint32_t header[2] = { BINARY_VERSION, static_cast<uint32_t>(sizeof(StepSummary)) };
+                out->write("AEPS", 4);
+                out->write(reinterpret_cast<const char *>(header), sizeof(header));
+            } else {
+                *out << "seed,step,mice,owls\n";
+                if (spatial_distance > 0) {
+                    *out << "spatial,seed,step,mouse_clusters,mean_mouse_cluster,largest_mouse_cluster,"
+                            "grass_patches,largest_grass_patch";
+                    for (size_t r = 1; r <= spatial_distance; r++) *out << ",owl_mouse_g" << r;
+                    *out << '\n';
+                }
+            }
+        }
+
+        /**
+         * @brief Check that the output opened successfully
+         * @return True if rows can be written
+         */
+        bool IsOpen() const { return out->good(); }
+
+        /**
+         * @brief Append a block of rows
+         * @param rows Rows to write (in order)
+         */
+        void Write(const emp::vector<StepSummary> & rows) {
+            if (binary) {
+                std::lock_guard<std::mutex> lock(mutex);
+                out->write(reinterpret_cast<const char *>(rows.data()), rows.size() * sizeof(StepSummary));
+                return;
+            }
+
+            std::ostringstream text;
+            for (const StepSummary & row : rows) {
+                text << row.seed << ',' << row.step << ',' << row.mice << ',' << row.owls << '\n';
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            *out << text.str();
+        }
+
+        /**
+         * @brief Append one spatial analysis row (CSV only)
+         * @param summary Result to write
+         */
+        void WriteSpatial(const SpatialSummary & summary) {
+            std::ostringstream text;
+            text << "spatial," << summary.seed << ',' << summary.step << ','
+                 << summary.mice.GetCount() << ',' << summary.mice.GetMean() << ',' << summary.mice.GetLargest() << ','
+                 << summary.grass.GetCount() << ',' << summary.grass.GetLargest();
+            for (double g : summary.owl_mouse) text << ',' << g;
+            text << '\n';
+            std::lock_guard<std::mutex> lock(mutex);
+            *out << text.str();
+        }
+
+        /**
+         * @brief Flush buffered output
+         */
+        void Flush() {
+            std::lock_guard<std::mutex> lock(mutex);
+            out->flush();
+        }
+};
+
+/**
+ * @brief Runs independent replicates of the ecology across all cores
+ *
+ * Each seed gets its own world and generator, populated exactly as
+ * AEAnimator does (or restored from a checkpoint), and streams one
+ * StepSummary per step to the writer. Periodic checkpoints are handed to a
+ * single background CheckpointWriter shared by all replicates. The
+ * ensemble engine instead runs consecutive seeds in the lanes of one
+ * EnsembleWorld, which gives each seed the same rows as the grid engine.
+ * With analysis on, every replicate (or ensemble) hands grid snapshots to
+ * a SpatialAnalyzer thread of its own, which writes spatial rows as it
+ * finishes them. A ReplicateMonitor per replicate can end it early once
+ * it goes extinct, empty or steady, and the scheduler then gives its core
+ * to the next seed.
+ */
+class BatchRunner {
+    private:
+        static constexpr size_t FLUSH_ROWS = 1024; ///< Rows buffered per replicate before writing
+
+        using Ensemble = EnsembleWorld<>;          ///< Lane count used by the ensemble engine
+
+        BatchConfig config;                        ///< Batch settings
+        emp::Ptr<CheckpointWriter> checkpoints;    ///< Background checkpoint writer (null when disabled)
+        std::atomic<size_t> failed_replicates{0};  ///< Replicates that could not start or record
+        std::array<std::atomic<size_t>, 4> detections{}; ///< Replicates ended early, by ReplicateMonitor::Detection
+
+    public:
+        /**
+         * @brief Construct a runner
+         * @param _config Batch settings
+         */
+        explicit BatchRunner(const BatchConfig & _config) : config(_config) {}
+
+        /**
+         * @brief Run every seed in the configured range
+         * @param writer Destination for per-step summaries
+         * @return False if a replicate could not be restored or recorded, or a checkpoint failed to write
+         */
+        bool Run(SummaryWriter & writer) {
+            failed_replicates = 0;
+            for (std::atomic<size_t> & count : detections) count = 0;
+            if (config.engine == "distributed") return RunDistributed(writer);
+            if (config.checkpoint_every > 0) checkpoints.New();
+            WorkStealingScheduler scheduler(config.threads);
+            const size_t num_seeds = static_cast<size_t>(config.last_seed - config.first_seed) + 1;
+            if (config.engine == "ensemble") {
+                // One task per ensemble of consecutive seeds
+                const size_t num_ensembles = (num_seeds + Ensemble::NUM_LANES - 1) / Ensemble::NUM_LANES;
+                scheduler.Run(num_ensembles, [&](size_t id, size_t) {
+                    RunEnsemble(config.first_seed + static_cast<int>(id * Ensemble::NUM_LANES), writer);
+                });
+            } else {
+                scheduler.Run(num_seeds, [&](size_t id, size_t) {
+                    const int seed = config.first_seed + static_cast<int>(id);
+                    if (config.engine == "grid") RunGridReplicate(seed, writer);
+                    else if (config.engine == "chunked") RunChunkedReplicate(seed, writer);
+                    else RunOrgReplicate(seed, writer);
+                });
+            }
+            writer.Flush();
+            ReportDetections();
+
+            size_t checkpoint_failures = 0;
+            if (checkpoints) {
+                checkpoints->Close();
+                checkpoint_failures = checkpoints->GetFailures();
+                if (checkpoint_failures) std::cerr << "ae_lab: " << checkpoint_failures << " checkpoints failed to write" << std::endl;
+                checkpoints.Delete();
+                checkpoints = nullptr;
+            }
+            return failed_replicates == 0 && checkpoint_failures == 0;
+        }
+
+    private:
+        /**
+         * @brief Run one OrgWorld replicate
+         * @param seed Seed for the replicate's generator
+         * @param writer Destination for summaries
+         */
+        void RunOrgReplicate(int seed, SummaryWriter & writer) {
+            emp::Random random(seed);
+            OrgWorld world(random, config.update == "synchronous" ? OrgWorld::UpdateMode::SYNCHRONOUS
+                                                                  : OrgWorld::UpdateMode::ASYNCHRONOUS);
+            world.SetPopStruct_Grid(config.ecology.width, config.ecology.height);
+            if (config.schedule == "active") world.SetScheduleMode(OrgWorld::ScheduleMode::ACTIVE_LIST);
+            if (config.random == "counter") world.SetRandomMode(OrgWorld::RandomMode::COUNTER, static_cast<uint32_t>(seed));
+            if (config.move == "two-phase") world.SetMoveMode(OrgWorld::MoveMode::TWO_PHASE);
+            if (config.world_threads > 1) world.SetThreads(config.world_threads);
+            RunReplicate(world, random, seed, writer);
+        }
+
+        /**
+         * @brief Run one GridWorld replicate
+         * @param seed Seed for the replicate's generator
+         * @param writer Destination for summaries
+         */
+        void RunGridReplicate(int seed, SummaryWriter & writer) {
+            size_t width, height;
+            GetStartSize(width, height);
+            emp::Random random(seed);
+            GridWorld world(random, width, height);
+            world.SetBlockSchedule(config.schedule == "block");
+            RunReplicate(world, random, seed, writer);
+        }
+
+        /**
+         * @brief Run one ChunkedWorld replicate
+         * @param seed Seed for the replicate's generator
+         * @param writer Destination for summaries
+         */
+        void RunChunkedReplicate(int seed, SummaryWriter & writer) {
+            size_t width, height;
+            GetStartSize(width, height);
+            emp::Random random(seed);
+            ChunkedWorld world(random, width, height);
+            RunReplicate(world, random, seed, writer);
+        }
+
+        /**
+         * @brief Get the grid size a fixed-size world should be built at
+         *
+         * A GridWorld or ChunkedWorld cannot be resized, so a replicate that
+         * starts from a checkpoint is built at the checkpoint's size.
+         * @param width Set to the grid width
+         * @param height Set to the grid height
+         */
+        void GetStartSize(size_t & width, size_t & height) const {
+            width = config.ecology.width;
+            height = config.ecology.height;
+            MappedCheckpoint checkpoint;
+            std::string error;
+            if (!StartCheckpoint().empty() && checkpoint.Open(StartCheckpoint(), error)) {
+                width = checkpoint.GetHeader().width;
+                height = checkpoint.GetHeader().height;
+            }
+        }
+
+        /**
+         * @brief Run every seed in turn, each split across config.processes workers
+         *
+         * Seeds run one after another since each one already uses every
+         * worker process; no threads are started, so forking is safe.
+         * @param writer Destination for summaries
+         * @return False if any seed failed
+         */
+        bool RunDistributed(SummaryWriter & writer) {
+            DistributedRunner runner(config.ecology, config.processes);
+            for (int seed = config.first_seed; seed <= config.last_seed; seed++) {
+                emp::vector<StepSummary> rows;
+                rows.reserve(FLUSH_ROWS);
+                auto on_step = [&](size_t step, const std::array<size_t, RegisteredSpecies::SIZE> & counts) {
+                    rows.push_back({ static_cast<uint32_t>(seed), static_cast<uint32_t>(step),
+                                     static_cast<uint32_t>(counts[Mouse::SPECIES_ID]),
+                                     static_cast<uint32_t>(counts[Owl::SPECIES_ID]) });
+                    if (rows.size() == FLUSH_ROWS) {
+                        writer.Write(rows);
+                        rows.clear();
+                    }
+                };
+                std::string error;
+                const bool ok = runner.Run(seed, config.steps, on_step, error);
+                if (!rows.empty()) writer.Write(rows);
+                if (!ok) {
+                    std::cerr << "ae_lab: seed " << seed << ": " << error << std::endl;
+                    failed_replicates++;
+                }
+            }
+            writer.Flush();
+            return failed_replicates == 0;
+        }
+
+        /**
+         * @brief Run up to Ensemble::NUM_LANES consecutive seeds as one EnsembleWorld
+         *
+         * Each lane is populated from its own generator exactly as a GridWorld
+         * replicate of that seed, and gets its own summary rows and recording.
+         * @param first_seed Seed of lane 0 (later lanes take the following seeds)
+         * @param writer Destination for summaries
+         */
+        void RunEnsemble(int first_seed, SummaryWriter & writer) {
+            emp::vector<int> seeds;
+            for (int seed = first_seed; seed <= config.last_seed && seeds.size() < Ensemble::NUM_LANES; seed++) {
+                seeds.push_back(seed);
+            }
+
+            Ensemble world(config.ecology.width, config.ecology.height, seeds);
+            emp::vector<EnsembleLane<Ensemble::NUM_LANES>> lanes;
+            for (size_t lane = 0; lane < seeds.size(); lane++) {
+                lanes.emplace_back(world, lane);
+                PopulateWithMice(lanes[lane], world.GetRandom(lane), config.ecology);
+                PopulateWithOwls(lanes[lane], world.GetRandom(lane), config.ecology);
+            }
+
+            emp::vector<emp::Ptr<TrajectoryRecorder>> recorders(seeds.size(), nullptr);
+            if (config.record_every > 0) {
+                for (size_t lane = 0; lane < seeds.size(); lane++) {
+                    recorders[lane].New(config.record_prefix + "-" + std::to_string(seeds[lane]) + ".aetr",
+                                        world.GetWidth(), world.GetHeight(), config.record_every);
+                }
+            }
+
+            emp::Ptr<SpatialAnalyzer> analyzer = StartAnalyzer(writer);
+            emp::vector<ReplicateMonitor> monitors(seeds.size(), ReplicateMonitor(GetMonitorSettings()));
+            emp::vector<bool> finished(seeds.size(), false);
+            size_t running = seeds.size();
+
+            // Rows are buffered per lane so each block handed to the writer holds one seed.
+            // Lanes that finish early are left to idle; the world stops once none are running.
+            emp::vector<emp::vector<StepSummary>> rows(seeds.size());
+            for (emp::vector<StepSummary> & lane_rows : rows) lane_rows.reserve(FLUSH_ROWS);
+            for (size_t step = 0; step <= config.steps && running > 0; step++) {
+                if (step > 0) world.UpdateEcology();
+
+                const auto counts = world.CountSpecies();
+                for (size_t lane = 0; lane < seeds.size(); lane++) {
+                    if (finished[lane]) continue;
+                    if (recorders[lane]) recorders[lane]->Capture(lanes[lane]);
+                    if (analyzer && world.GetStep() % config.analyze_every == 0) analyzer->Capture(lanes[lane], seeds[lane]);
+                    AddRow(rows[lane], seeds[lane], world.GetStep(), counts[lane], writer);
+                    if (monitors[lane].IsActive()
+                        && Finish(monitors[lane], monitors[lane].Observe(counts[lane]), lanes[lane], seeds[lane],
+                                  config.steps - step, rows[lane], writer)) {
+                        finished[lane] = true;
+                        running--;
+                    }
+                }
+            }
+            for (const emp::vector<StepSummary> & lane_rows : rows) {
+                if (!lane_rows.empty()) writer.Write(lane_rows);
+            }
+            StopAnalyzer(analyzer);
+
+            for (size_t lane = 0; lane < seeds.size(); lane++) {
+                if (!recorders[lane]) continue;
+                recorders[lane]->Close();
+                if (!recorders[lane]->IsOpen()) {
+                    std::cerr << "ae_lab: seed " << seeds[lane] << ": trajectory could not be written" << std::endl;
+                    failed_replicates++;
+                }
+                recorders[lane].Delete();
+            }
+        }
+
+        /**
+         * @brief Get the detector settings every replicate's monitor uses
+         * @return Actions and steady-state parameters from the configuration
+         */
+        ReplicateMonitor::Settings GetMonitorSettings() const {
+            ReplicateMonitor::Settings settings;
+            ParseDetectorAction(config.on_absorbing, settings.on_absorbing);
+            ParseDetectorAction(config.on_extinction, settings.on_extinction);
+            ParseDetectorAction(config.on_steady, settings.on_steady);
+            settings.steady_window = config.steady_window;
+            settings.steady_tolerance = config.steady_tolerance;
+            return settings;
+        }
+
+        /**
+         * @brief Buffer one summary row, handing the block to the writer when full
+         * @param rows The replicate's buffered rows
+         * @param seed Replicate seed
+         * @param step Step the counts belong to
+         * @param counts Organisms per species
+         * @param writer Destination for summaries
+         */
+        static void AddRow(emp::vector<StepSummary> & rows, int seed, size_t step,
+                           const std::array<size_t, RegisteredSpecies::SIZE> & counts, SummaryWriter & writer) {
+            rows.push_back({ static_cast<uint32_t>(seed), static_cast<uint32_t>(step),
+                             static_cast<uint32_t>(counts[Mouse::SPECIES_ID]),
+                             static_cast<uint32_t>(counts[Owl::SPECIES_ID]) });
+            if (rows.size() == FLUSH_ROWS) {
+                writer.Write(rows);
+                rows.clear();
+            }
+        }
+
+        /**
+         * @brief Act on a monitor's verdict for the step just summarized
+         *
+         * A fast-forward writes the projected rows for every remaining step.
+         * @param monitor The replicate's monitor, after Observe
+         * @param action What Observe returned
+         * @param world The replicate's world
+         * @param seed Replicate seed
+         * @param remaining Steps left in the run
+         * @param rows The replicate's buffered rows
+         * @param writer Destination for summaries
+         * @return True if the replicate is finished
+         */
+        template <typename WORLD>
+        bool Finish(const ReplicateMonitor & monitor, DetectorAction action, const WORLD & world, int seed,
+                    size_t remaining, emp::vector<StepSummary> & rows, SummaryWriter & writer) {
+            if (action == DetectorAction::RUN) return false;
+            if (action == DetectorAction::FAST_FORWARD) {
+                monitor.FastForward(world, remaining, [&](size_t ahead, const ReplicateMonitor::Counts & counts) {
+                    AddRow(rows, seed, world.GetStep() + ahead, counts, writer);
+                });
+            }
+            detections[static_cast<size_t>(monitor.GetDetection())]++;
+            return true;
+        }
+
+        /**
+         * @brief Report how many replicates detectors ended early
+         */
+        void ReportDetections() const {
+            using Detection = ReplicateMonitor::Detection;
+            const size_t ended = detections[static_cast<size_t>(Detection::ABSORBING)]
+                               + detections[static_cast<size_t>(Detection::EXTINCTION)]
+                               + detections[static_cast<size_t>(Detection::STEADY_STATE)];
+            if (ended == 0) return;
+            std::cerr << "ae_lab: " << ended << " replicates ended early (";
+            for (Detection detection : { Detection::ABSORBING, Detection::EXTINCTION, Detection::STEADY_STATE }) {
+                if (detection != Detection::ABSORBING) std::cerr << ", ";
+                std::cerr << ReplicateMonitor::GetName(detection) << ' ' << detections[static_cast<size_t>(detection)];
+            }
+            std::cerr << ')' << std::endl;
+        }
+
+        /**
+         * @brief Start a background spatial analyzer writing to the summary output
+         * @param writer Destination for spatial rows
+         * @return The analyzer, or null when analysis is off
+         */
+        emp::Ptr<SpatialAnalyzer> StartAnalyzer(SummaryWriter & writer) {
+            emp::Ptr<SpatialAnalyzer> analyzer;
+            if (config.analyze_every > 0) {
+                analyzer.New([&writer](const SpatialSummary & summary) { writer.WriteSpatial(summary); },
+                             config.analysis_distance, config.analysis_threads);
+            }
+            return analyzer;
+        }
+
+        /**
+         * @brief Wait for an analyzer to write its remaining rows, then free it
+         * @param analyzer Analyzer from StartAnalyzer (may be null)
+         */
+        static void StopAnalyzer(emp::Ptr<SpatialAnalyzer> & analyzer) {
+            if (!analyzer) return;
+            analyzer->Close();
+            analyzer.Delete();
+            analyzer = nullptr;
+        }
+
+        /**
+         * @brief Get the checkpoint replicates start from
+         * @return The resume or fork path (empty to populate from scratch)
+         */
+        const std::string & StartCheckpoint() const {
+            return config.resume.empty() ? config.fork : config.resume;
+        }
+
+        /**
+         * @brief Give a fresh world its starting state
+         *
+         * Populates it, or restores the resume/fork checkpoint. A forked
+         * replicate is reseeded with its own seed so replicates diverge.
+         * @param world Empty world
+         * @param random The world's generator
+         * @param seed Replicate seed
+         * @return False if the checkpoint could not be restored
+         */
+        template <typename WORLD>
+        bool StartReplicate(WORLD & world, emp::Random & random, int seed) {
+            const std::string & path = StartCheckpoint();
+            if (path.empty()) {
+                PopulateWithMice(world, random, config.ecology);
+                PopulateWithOwls(world, random, config.ecology);
+                return true;
+            }
+
+            std::string error;
+            if (!RestoreCheckpoint(path, world, random, error)) {
+                std::cerr << "ae_lab: seed " << seed << ": " << error << std::endl;
+                return false;
+            }
+            if (!config.fork.empty()) random.ResetSeed(seed);
+            return true;
+        }
+
+        /**
+         * @brief Populate a world, run it and stream its summaries
+         * @param world Empty world to run
+         * @param random The world's generator
+         * @param seed Replicate seed (recorded in every row)
+         * @param writer Destination for summaries
+         */
+        template <typename WORLD>
+        void RunReplicate(WORLD & world, emp::Random & random, int seed, SummaryWriter & writer) {
+            if (!StartReplicate(world, random, seed)) {
+                failed_replicates++;
+                return;
+            }
+
+            emp::Ptr<TrajectoryRecorder> recorder;
+            if (config.record_every > 0) {
+                recorder.New(config.record_prefix + "-" + std::to_string(seed) + ".aetr",
+                             world.GetWidth(), world.GetHeight(), config.record_every);
+            }
+
+            emp::Ptr<SpatialAnalyzer> analyzer = StartAnalyzer(writer);
+
+            ReplicateMonitor monitor(GetMonitorSettings());
+
+            emp::vector<StepSummary> rows;
+            rows.reserve(FLUSH_ROWS);
+            for (size_t step = 0; step <= config.steps; step++) {
+                if (step > 0) {
+                    world.UpdateEcology();
+                    if (checkpoints && world.GetStep() % config.checkpoint_every == 0) {
+                        checkpoints->Submit(config.checkpoint_prefix + "-" + std::to_string(seed) + "-"
+                                            + std::to_string(world.GetStep()) + ".aecp",
+                                            CaptureSnapshot(world, random));
+                    }
+                }
+
+                if (recorder) recorder->Capture(world);
+                if (analyzer && world.GetStep() % config.analyze_every == 0) analyzer->Capture(world, seed);
+
+                const std::array<size_t, RegisteredSpecies::SIZE> counts = CountSpecies(world);
+                AddRow(rows, seed, world.GetStep(), counts, writer);
+                if (monitor.IsActive() && Finish(monitor, monitor.Observe(counts), world, seed, config.steps - step, rows, writer)) break;
+            }
+            if (!rows.empty()) writer.Write(rows);
+            StopAnalyzer(analyzer);
+
+            if (recorder) {
+                recorder->Close();
+                if (!recorder->IsOpen()) {
+                    std::cerr << "ae_lab: seed " << seed << ": trajectory could not be written" << std::endl;
+                    failed_replicates++;
+                }
+                recorder.Delete();
+            }
+        }
+};
+
+#endif
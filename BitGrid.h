@@ -0,0 +1,291 @@
+#ifndef BIT_GRID_H
+#define BIT_GRID_H
+
+#include "emp/base/vector.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief One bit per cell of a toroidal grid, packed 64 cells to a word
+ *
+ * Rows are padded to a whole number of BitPlane::ROW_ALIGN words so the
+ * neighbor counter can always work on full SIMD vectors; padding bits are
+ * kept zero.
+ */
+class BitPlane {
+    public:
+        static constexpr size_t ROW_ALIGN = 4; ///< Row length is a multiple of this many words (256 bits)
+
+    private:
+        size_t width = 0;              ///< Grid width in cells
+        size_t height = 0;             ///< Grid height in cells
+        size_t words_per_row = 0;      ///< Words per row, including padding
+        emp::vector<uint64_t> words;   ///< Row-major bits; bit x % 64 of word x / 64 is column x
+
+    public:
+        BitPlane() = default;
+
+        /**
+         * @brief Construct an all-zero plane
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         */
+        BitPlane(size_t _width, size_t _height) { Resize(_width, _height); }
+
+        /**
+         * @brief Resize the plane and clear every bit
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         */
+        void Resize(size_t _width, size_t _height) {
+            width = _width;
+            height = _height;
+            words_per_row = ((width + 63) / 64 + ROW_ALIGN - 1) / ROW_ALIGN * ROW_ALIGN;
+            words.assign(words_per_row * height, 0);
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+        size_t GetWordsPerRow() const { return words_per_row; }
+
+        /**
+         * @brief Get the words of one row
+         * @param y Row index
+         * @return Pointer to GetWordsPerRow() words
+         */
+        const uint64_t * Row(size_t y) const { return words.data() + y * words_per_row; }
+        uint64_t * Row(size_t y) { return words.data() + y * words_per_row; }
+
+        /**
+         * @brief Read one cell
+         * @param x Column
+         * @param y Row
+         * @return True if the bit is set
+         */
+        bool Test(size_t x, size_t y) const { return (Row(y)[x / 64] >> (x % 64)) & 1; }
+
+        /**
+         * @brief Write one cell
+         * @param x Column
+         * @param y Row
+         * @param value New bit value
+         */
+        void Set(size_t x, size_t y, bool value) {
+            const uint64_t bit = uint64_t(1) << (x % 64);
+            if (value) Row(y)[x / 64] |= bit;
+            else Row(y)[x / 64] &= ~bit;
+        }
+
+        /**
+         * @brief Fill the plane from a row-major byte grid
+         *
+         * Sets a cell's bit when (cells[i] == value) equals match, comparing 16
+         * bytes at a time with SSE2 where available.
+         * @param cells One byte per cell, width * height of them
+         * @param value Byte value to compare against
+         * @param match True to flag cells equal to value, false to flag the rest
+         */
+        void Pack(const uint8_t * cells, uint8_t value, bool match) {
+            std::fill(words.begin(), words.end(), 0);
+            for (size_t y = 0; y < height; y++) {
+                const uint8_t * src = cells + y * width;
+                uint64_t * row = Row(y);
+                size_t x = 0;
+#if defined(__SSE2__)
+                const __m128i target = _mm_set1_epi8(static_cast<char>(value));
+                for (; x + 16 <= width; x += 16) {
+                    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+                    uint64_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, target)));
+                    if (!match) mask ^= 0xFFFF;
+                    row[x / 64] |= mask << (x % 64);
+                }
+#endif
+                for (; x < width; x++) {
+                    if ((src[x] == value) == match) row[x / 64] |= uint64_t(1) << (x % 64);
+                }
+            }
+        }
+};
+
+/**
+ * @brief Per-cell neighbor counts (0-8) stored as four bit-sliced planes
+ *
+ * Bit k of a cell's count lives in slice k. Slices are interleaved in blocks
+ * of BitPlane::ROW_ALIGN words, so the four words holding one cell's count
+ * sit 32 bytes apart instead of a whole plane apart.
+ */
+class NeighborCounts {
+    public:
+        static constexpr size_t NUM_SLICES = 4;                ///< Bits per count (8 needs four)
+        static constexpr size_t BLOCK = BitPlane::ROW_ALIGN;   ///< Words per slice in one block
+
+    private:
+        size_t width = 0;              ///< Grid width in cells
+        size_t height = 0;             ///< Grid height in cells
+        size_t words_per_row = 0;      ///< Words per slice row, as in the source BitPlane
+        emp::vector<uint64_t> slices;  ///< Blocks of NUM_SLICES * BLOCK words, row-major
+
+    public:
+        /**
+         * @brief Match the shape of a source plane
+         * @param plane Plane whose neighbors will be counted
+         */
+        void Resize(const BitPlane & plane) {
+            width = plane.GetWidth();
+            height = plane.GetHeight();
+            words_per_row = plane.GetWordsPerRow();
+            slices.resize(words_per_row * height * NUM_SLICES);
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+
+        /**
+         * @brief Get the block holding words [j, j + BLOCK) of every slice of a row
+         * @param y Row index
+         * @param j First word of the block (a multiple of BLOCK)
+         * @return Slice k of word j + i is at [k * BLOCK + i]
+         */
+        uint64_t * Block(size_t y, size_t j) { return slices.data() + (y * words_per_row + j) * NUM_SLICES; }
+
+        /**
+         * @brief Read one cell's count
+         * @param x Column
+         * @param y Row
+         * @return Number of set neighbors (0-8)
+         */
+        size_t Get(size_t x, size_t y) const {
+            const size_t word = x / 64;
+            const size_t shift = x % 64;
+            const uint64_t * block = slices.data() + (y * words_per_row + (word & ~(BLOCK - 1))) * NUM_SLICES
+                                     + (word & (BLOCK - 1));
+            return ((block[0] >> shift) & 1) | (((block[BLOCK] >> shift) & 1) << 1)
+                 | (((block[2 * BLOCK] >> shift) & 1) << 2) | (((block[3 * BLOCK] >> shift) & 1) << 3);
+        }
+
+        /**
+         * @brief Expand every count to one byte per cell
+         * @param out Resized to width * height; receives the counts row-major
+         */
+        void ToBytes(emp::vector<uint8_t> & out) const {
+            out.resize(width * height);
+            for (size_t y = 0; y < height; y++) {
+                for (size_t x = 0; x < width; x++) out[y * width + x] = static_cast<uint8_t>(Get(x, y));
+            }
+        }
+};
+
+/**
+ * @brief Counts set neighbors of every cell of a BitPlane at once
+ *
+ * Builds copies of the plane shifted one column left and right (wrapping
+ * around the torus), then adds the 8 shifted rows around each row with a
+ * bit-sliced carry-save adder, 256 cells per vector operation (one AVX2
+ * register when compiled for it, two SSE registers otherwise). Duplicate
+ * neighbors on 2-wide or 2-tall grids are counted twice, like
+ * NeighborStencil lists them.
+ */
+class NeighborCounter {
+    private:
+        /// Four words handled as one vector by the GCC/Clang vector extension
+        typedef uint64_t Lanes __attribute__((vector_size(32)));
+
+        BitPlane west;   ///< Bit x is the source bit of column x - 1
+        BitPlane east;   ///< Bit x is the source bit of column x + 1
+
+    public:
+        /**
+         * @brief Count the set neighbors of every cell
+         * @param plane Source plane (at least 1 cell wide)
+         * @param counts Receives the count of every cell
+         */
+        void Count(const BitPlane & plane, NeighborCounts & counts) {
+            const size_t width = plane.GetWidth();
+            const size_t height = plane.GetHeight();
+            const size_t num_words = plane.GetWordsPerRow();
+            counts.Resize(plane);
+            if (west.GetWidth() != width || west.GetHeight() != height) {
+                west.Resize(width, height);
+                east.Resize(width, height);
+            }
+            ShiftColumns(plane);
+
+            for (size_t y = 0; y < height; y++) {
+                const size_t up = y == 0 ? height - 1 : y - 1;
+                const size_t down = y + 1 == height ? 0 : y + 1;
+                const uint64_t * inputs[8] = {
+                    west.Row(up), west.Row(y), west.Row(down), plane.Row(up),
+                    plane.Row(down), east.Row(up), east.Row(y), east.Row(down)
+                };
+                for (size_t j = 0; j < num_words; j += NeighborCounts::BLOCK) {
+                    AddRows(inputs, j, counts.Block(y, j));
+                }
+            }
+        }
+
+    private:
+        /**
+         * @brief Fill the west and east planes from the source plane
+         * @param plane Source plane
+         */
+        void ShiftColumns(const BitPlane & plane) {
+            const size_t width = plane.GetWidth();
+            const size_t last_word = (width - 1) / 64;
+            const uint64_t last_bit = uint64_t(1) << ((width - 1) % 64);
+            for (size_t y = 0; y < plane.GetHeight(); y++) {
+                const uint64_t * src = plane.Row(y);
+                uint64_t * w = west.Row(y);
+                uint64_t * e = east.Row(y);
+                for (size_t j = 0; j <= last_word; j++) {
+                    w[j] = (src[j] << 1) | (j > 0 ? src[j - 1] >> 63 : 0);
+                    e[j] = (src[j] >> 1) | (j < last_word ? src[j + 1] << 63 : 0);
+                }
+                // Wrap around the torus and keep the padding clear
+                w[0] |= (src[last_word] & last_bit) ? 1 : 0;
+                w[last_word] &= last_bit | (last_bit - 1);
+                if (src[0] & 1) e[last_word] |= last_bit;
+            }
+        }
+
+        /**
+         * @brief Add 8 one-bit rows into 4 bit-sliced sums for 256 cells
+         * @param inputs The 8 neighbor rows
+         * @param j First word of the block
+         * @param block Destination block in a NeighborCounts
+         */
+        static void AddRows(const uint64_t * const inputs[8], size_t j, uint64_t * block) {
+            Lanes in[8];
+            for (size_t k = 0; k < 8; k++) std::memcpy(&in[k], inputs[k] + j, sizeof(Lanes));
+
+            // Ones: two full adders, a half adder, then a full adder of their sums
+            const Lanes s0 = in[0] ^ in[1] ^ in[2];
+            const Lanes c0 = (in[0] & in[1]) | (in[2] & (in[0] ^ in[1]));
+            const Lanes s1 = in[3] ^ in[4] ^ in[5];
+            const Lanes c1 = (in[3] & in[4]) | (in[5] & (in[3] ^ in[4]));
+            const Lanes s2 = in[6] ^ in[7];
+            const Lanes c2 = in[6] & in[7];
+            const Lanes bit0 = s0 ^ s1 ^ s2;
+            const Lanes c3 = (s0 & s1) | (s2 & (s0 ^ s1));
+
+            // Twos: four carries
+            const Lanes t0 = c0 ^ c1 ^ c2;
+            const Lanes d0 = (c0 & c1) | (c2 & (c0 ^ c1));
+            const Lanes bit1 = t0 ^ c3;
+            const Lanes d1 = t0 & c3;
+
+            // Fours and eights
+            const Lanes bit2 = d0 ^ d1;
+            const Lanes bit3 = d0 & d1;
+
+            std::memcpy(block, &bit0, sizeof(Lanes));
+            std::memcpy(block + NeighborCounts::BLOCK, &bit1, sizeof(Lanes));
+            std::memcpy(block + 2 * NeighborCounts::BLOCK, &bit2, sizeof(Lanes));
+            std::memcpy(block + 3 * NeighborCounts::BLOCK, &bit3, sizeof(Lanes));
+        }
+};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief Fixed-capacity blocking queue for handing work to a background thread
+ *
+ * Producers block in Push while the queue is full, so a slow consumer
+ * applies back-pressure instead of letting memory grow without bound.
+ * Close wakes everyone; Pop keeps returning queued items until it drains.
+ */
+template <typename T>
+class BoundedQueue {
+    private:
+        size_t capacity;                   ///< Most items held at once
+        std::deque<T> items;               ///< Queued items, oldest first
+        bool closed = false;               ///< Set once no more items will arrive
+        std::mutex mutex;                  ///< Guards items and closed
+        std::condition_variable not_empty; ///< Signaled when an item is added or the queue closes
+        std::condition_variable not_full;  ///< Signaled when an item is removed or the queue closes
+
+    public:
+        /**
+         * @brief Construct an empty queue
+         * @param _capacity Most items held at once (at least 1)
+         */
+        explicit BoundedQueue(size_t _capacity) : capacity(_capacity > 0 ? _capacity : 1) {}
+
+        /**
+         * @brief Add an item, waiting for room if the queue is full
+         * @param item Item to add
+         * @return False if the queue was closed (the item is dropped)
+         */
+        bool Push(T item) {
+            std::unique_lock<std::mutex> lock(mutex);
+            not_full.wait(lock, [&] { return closed || items.size() < capacity; });
+            if (closed) return false;
+            items.push_back(std::move(item));
+            not_empty.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief Take the oldest item, waiting until one arrives
+         * @param item Set to the item on success
+         * @return False once the queue is closed and drained
+         */
+        bool Pop(T & item) {
+            std::unique_lock<std::mutex> lock(mutex);
+            not_empty.wait(lock, [&] { return closed || !items.empty(); });
+            if (items.empty()) return false;
+            item = std::move(items.front());
+            items.pop_front();
+            not_full.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief Stop accepting items and wake all waiting threads
+         */
+        void Close() {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+            not_empty.notify_all();
+            not_full.notify_all();
+        }
+};
+
+#endif
@@ -0,0 +1,409 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "BoundedQueue.h"
+#include "Setup.h"
+
+/**
+ * @brief Fixed header at the start of a checkpoint file
+ *
+ * A checkpoint is this header, the raw bytes of the emp::Random (padded to
+ * a multiple of 8), width * height doubles of energy, width * height
+ * species bytes (GridWorld::EMPTY for grass) and num_listed uint32_t cell
+ * indices giving an ACTIVE_LIST OrgWorld's list order, all in native byte
+ * order.
+ */
+struct CheckpointHeader {
+    char magic[4];          ///< "AECP"
+    uint32_t version;       ///< CHECKPOINT_VERSION
+    uint64_t width;         ///< Grid width in cells
+    uint64_t height;        ///< Grid height in cells
+    uint64_t step;          ///< Completed steps when the snapshot was taken
+    uint32_t random_size;   ///< sizeof(emp::Random) on the writing machine
+    uint32_t reserved;      ///< Zero
+    uint64_t num_listed;    ///< Length of the active list (0 if the world kept none)
+};
+
+static constexpr uint32_t CHECKPOINT_VERSION = 2; ///< Current checkpoint format version
+
+// emp::Random holds only plain integers and a double (its empty destructor
+// keeps it from counting as trivially copyable), so its state is saved and
+// restored as raw bytes; random_size guards against a changed layout.
+
+/**
+ * @brief In-memory copy of everything needed to resume a world
+ */
+struct WorldSnapshot {
+    size_t width = 0;                         ///< Grid width in cells
+    size_t height = 0;                        ///< Grid height in cells
+    size_t step = 0;                          ///< Completed steps
+    emp::vector<unsigned char> random_state;  ///< Raw bytes of the world's generator
+    emp::vector<double> energy;               ///< Energy per cell
+    emp::vector<uint8_t> species;             ///< Species byte per cell
+    emp::vector<uint32_t> listed;             ///< Active list order (empty if the world keeps none)
+};
+
+/**
+ * @brief Copy an OrgWorld's active list order into a snapshot
+ * @param world World being captured
+ * @param snapshot Snapshot to fill
+ */
+inline void CaptureListOrder(const OrgWorld & world, WorldSnapshot & snapshot) {
+    const emp::vector<size_t> & order = world.GetOccupiedOrder();
+    snapshot.listed.assign(order.begin(), order.end());
+}
+
+/**
+ * @brief Engines without an order-dependent active list save none
+ */
+inline void CaptureListOrder(const GridWorld &, WorldSnapshot &) {}
+inline void CaptureListOrder(const ChunkedWorld &, WorldSnapshot &) {}
+
+/**
+ * @brief Round a byte count up to a multiple of 8
+ * @param bytes Byte count
+ * @return Padded count
+ */
+inline size_t CheckpointPad(size_t bytes) { return (bytes + 7) & ~size_t(7); }
+
+/**
+ * @brief Copy a world's state so it can be written while the run continues
+ * @param world World to copy (OrgWorld, GridWorld or ChunkedWorld)
+ * @param random The world's generator
+ * @return Snapshot of the grid, generator and step counter
+ */
+template <typename WORLD>
+WorldSnapshot CaptureSnapshot(const WORLD & world, const emp::Random & random) {
+    WorldSnapshot snapshot;
+    snapshot.width = world.GetWidth();
+    snapshot.height = world.GetHeight();
+    snapshot.step = world.GetStep();
+    snapshot.random_state.resize(sizeof(emp::Random));
+    std::memcpy(snapshot.random_state.data(), &random, sizeof(emp::Random));
+
+    const size_t num_cells = snapshot.width * snapshot.height;
+    snapshot.energy.resize(num_cells);
+    snapshot.species.resize(num_cells);
+    for (size_t i = 0; i < num_cells; i++) {
+        snapshot.species[i] = GetCellSpecies(world, i);
+        snapshot.energy[i] = GetCellPoints(world, i);
+    }
+    CaptureListOrder(world, snapshot);
+    return snapshot;
+}
+
+/**
+ * @brief Write a snapshot to disk
+ *
+ * Writes to "path.tmp" and renames it over path, so a crash mid-write
+ * never leaves a truncated checkpoint under the real name.
+ * @param snapshot Snapshot to write
+ * @param path Destination file
+ * @return False if the file could not be written
+ */
+inline bool WriteCheckpoint(const WorldSnapshot & snapshot, const std::string & path) {
+    CheckpointHeader header = {};
+    std::memcpy(header.magic, "AECP", 4);
+    header.version = CHECKPOINT_VERSION;
+    header.width = snapshot.width;
+    header.height = snapshot.height;
+    header.step = snapshot.step;
+    header.random_size = static_cast<uint32_t>(snapshot.random_state.size());
+    header.num_listed = snapshot.listed.size();
+
+    const std::string tmp_path = path + ".tmp";
+    FILE * file = std::fopen(tmp_path.c_str(), "wb");
+    if (!file) return false;
+
+    const char padding[8] = {};
+    const size_t num_cells = snapshot.species.size();
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && std::fwrite(snapshot.random_state.data(), 1, snapshot.random_state.size(), file) == snapshot.random_state.size();
+    const size_t pad = CheckpointPad(snapshot.random_state.size()) - snapshot.random_state.size();
+    ok = ok && std::fwrite(padding, 1, pad, file) == pad;
+    ok = ok && std::fwrite(snapshot.energy.data(), sizeof(double), num_cells, file) == num_cells;
+    ok = ok && std::fwrite(snapshot.species.data(), 1, num_cells, file) == num_cells;
+    ok = ok && std::fwrite(snapshot.listed.data(), sizeof(uint32_t), snapshot.listed.size(), file) == snapshot.listed.size();
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes snapshots on a background thread
+ *
+ * The simulation thread only pays for CaptureSnapshot (one pass over the
+ * grid); all file I/O happens on the writer thread. At most
+ * `capacity` snapshots wait in memory; beyond that Submit blocks until the
+ * writer catches up.
+ */
+class CheckpointWriter {
+    private:
+        BoundedQueue<std::pair<std::string, WorldSnapshot>> queue; ///< Snapshots waiting to be written
+        std::atomic<size_t> failures{0};                           ///< Snapshots that could not be written
+        std::thread thread;                                        ///< Writer thread
+
+    public:
+        /**
+         * @brief Start the writer thread
+         * @param capacity Most snapshots held in memory at once
+         */
+        explicit CheckpointWriter(size_t capacity=2) : queue(capacity) {
+            thread = std::thread([this] {
+                std::pair<std::string, WorldSnapshot> job;
+                while (queue.Pop(job)) {
+                    if (!WriteCheckpoint(job.second, job.first)) failures++;
+                }
+            });
+        }
+
+        /**
+         * @brief Finish writing queued snapshots and stop the thread
+         */
+        ~CheckpointWriter() { Close(); }
+
+        /**
+         * @brief Queue a snapshot for writing
+         * @param path Destination file
+         * @param snapshot Snapshot to write (moved into the queue)
+         */
+        void Submit(const std::string & path, WorldSnapshot snapshot) {
+            if (!queue.Push({path, std::move(snapshot)})) failures++;
+        }
+
+        /**
+         * @brief Write everything still queued and stop accepting snapshots
+         */
+        void Close() {
+            queue.Close();
+            if (thread.joinable()) thread.join();
+        }
+
+        /**
+         * @brief Get how many snapshots failed to write
+         * @return Failure count
+         */
+        size_t GetFailures() const { return failures; }
+};
+
+/**
+ * @brief Read-only memory mapping of a checkpoint file
+ */
+class MappedCheckpoint {
+    private:
+        const unsigned char * data = nullptr; ///< Start of the mapping
+        size_t size = 0;                      ///< Mapped bytes
+
+    public:
+        MappedCheckpoint() = default;
+        MappedCheckpoint(const MappedCheckpoint &) = delete;
+        MappedCheckpoint & operator=(const MappedCheckpoint &) = delete;
+        ~MappedCheckpoint() { if (data) munmap(const_cast<unsigned char *>(data), size); }
+
+        /**
+         * @brief Map a checkpoint and validate its layout
+         * @param path File to map
+         * @param error Set to a description of the problem on failure
+         * @return False if the file is missing, truncated, not a checkpoint or holds an unknown species
+         */
+        bool Open(const std::string & path, std::string & error) {
+            const int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                error = "cannot open checkpoint " + path;
+                return false;
+            }
+            struct stat info;
+            if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(CheckpointHeader)) {
+                close(fd);
+                error = "checkpoint too small: " + path;
+                return false;
+            }
+            size = static_cast<size_t>(info.st_size);
+            void * mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (mapping == MAP_FAILED) {
+                error = "cannot map checkpoint " + path;
+                return false;
+            }
+            data = static_cast<const unsigned char *>(mapping);
+
+            const CheckpointHeader & header = GetHeader();
+            if (std::memcmp(header.magic, "AECP", 4) != 0 || header.version != CHECKPOINT_VERSION) {
+                error = "not a version " + std::to_string(CHECKPOINT_VERSION) + " checkpoint: " + path;
+                return false;
+            }
+            if (header.random_size != sizeof(emp::Random)) {
+                error = "checkpoint was written with a different emp::Random layout: " + path;
+                return false;
+            }
+            if (!NeighborStencil::Supports(header.width, header.height)) {
+                error = "checkpoint has unsupported dimensions: " + path;
+                return false;
+            }
+            const size_t num_cells = header.width * header.height;
+            if (header.num_listed > num_cells
+                || size != EnergyOffset() + num_cells * (sizeof(double) + 1) + header.num_listed * sizeof(uint32_t)) {
+                error = "checkpoint size does not match its header: " + path;
+                return false;
+            }
+            const uint8_t * species = GetSpecies();
+            for (size_t i = 0; i < num_cells; i++) {
+                if (species[i] != GridWorld::EMPTY && species[i] >= RegisteredSpecies::SIZE) {
+                    error = "checkpoint has unknown species " + std::to_string(species[i]) + " at cell "
+                        + std::to_string(i) + ": " + path;
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        const CheckpointHeader & GetHeader() const { return *reinterpret_cast<const CheckpointHeader *>(data); }
+        const unsigned char * GetRandomState() const { return data + sizeof(CheckpointHeader); }
+        const double * GetEnergy() const { return reinterpret_cast<const double *>(data + EnergyOffset()); }
+        const uint8_t * GetSpecies() const {
+            return data + EnergyOffset() + GetHeader().width * GetHeader().height * sizeof(double);
+        }
+
+        /**
+         * @brief Copy out the saved active list order
+         * @return Cell indices in list order (empty if none was saved)
+         */
+        emp::vector<size_t> GetListed() const {
+            // The list follows the species bytes, so it may not be aligned
+            const unsigned char * listed = GetSpecies() + GetHeader().width * GetHeader().height;
+            emp::vector<size_t> order(GetHeader().num_listed);
+            for (size_t k = 0; k < order.size(); k++) {
+                uint32_t pos;
+                std::memcpy(&pos, listed + k * sizeof(uint32_t), sizeof(pos));
+                order[k] = pos;
+            }
+            return order;
+        }
+
+    private:
+        /**
+         * @brief Byte offset of the energy array
+         * @return Offset from the start of the file
+         */
+        size_t EnergyOffset() const { return sizeof(CheckpointHeader) + CheckpointPad(GetHeader().random_size); }
+};
+
+/**
+ * @brief Prepare an OrgWorld for restoring into
+ * @param world World to reset
+ * @param width Grid width from the checkpoint
+ * @param height Grid height from the checkpoint
+ * @return Always true; an OrgWorld is resized to fit
+ */
+inline bool ResetForRestore(OrgWorld & world, size_t width, size_t height) {
+    if (world.GetWidth() != width || world.GetHeight() != height || world.GetSize() != width * height) {
+        world.SetPopStruct_Grid(width, height);
+    }
+    for (size_t i = 0; i < world.GetSize(); i++) world.RemoveOrganism(i);
+    return true;
+}
+
+/**
+ * @brief Put an OrgWorld's active list back in its saved order
+ * @param world World whose organisms have been placed
+ * @param checkpoint Checkpoint being restored
+ * @return False if the saved order does not list exactly the occupied cells
+ */
+inline bool RestoreListOrder(OrgWorld & world, const MappedCheckpoint & checkpoint) {
+    // A checkpoint from a world without the list leaves it in index order
+    if (checkpoint.GetHeader().num_listed == 0) return true;
+    return world.SetOccupiedOrder(checkpoint.GetListed());
+}
+
+/**
+ * @brief Engines without an order-dependent active list ignore a saved one
+ * @return Always true
+ */
+inline bool RestoreListOrder(GridWorld &, const MappedCheckpoint &) { return true; }
+inline bool RestoreListOrder(ChunkedWorld &, const MappedCheckpoint &) { return true; }
+
+/**
+ * @brief Prepare a GridWorld for restoring into
+ * @param world World to reset (must already have the checkpoint's dimensions)
+ * @param width Grid width from the checkpoint
+ * @param height Grid height from the checkpoint
+ * @return False if the dimensions differ
+ */
+inline bool ResetForRestore(GridWorld & world, size_t width, size_t height) {
+    if (world.GetWidth() != width || world.GetHeight() != height) return false;
+    for (size_t i = 0; i < world.GetSize(); i++) world.RemoveOrganism(i);
+    return true;
+}
+
+/**
+ * @brief Prepare a ChunkedWorld for restoring into
+ * @param world World to reset (must already have the checkpoint's dimensions)
+ * @param width Grid width from the checkpoint
+ * @param height Grid height from the checkpoint
+ * @return False if the dimensions differ
+ */
+inline bool ResetForRestore(ChunkedWorld & world, size_t width, size_t height) {
+    if (world.GetWidth() != width || world.GetHeight() != height) return false;
+    emp::vector<size_t> occupied;
+    world.ForEachOrganism([&occupied](size_t pos, uint8_t, double) { occupied.push_back(pos); });
+    for (size_t pos : occupied) world.RemoveOrganism(pos);
+    return true;
+}
+
+/**
+ * @brief Rebuild a world from a checkpoint file
+ *
+ * Restores the grid, the generator state and the step counter, so further
+ * UpdateEcology calls continue exactly as the original run would have.
+ * Thread count and tile size are run settings, not state: an OrgWorld must
+ * use the same ones as the run that wrote the checkpoint to stay identical.
+ * @param path Checkpoint file
+ * @param world World to restore into (OrgWorld, or a GridWorld or ChunkedWorld of the same size)
+ * @param random The world's generator (overwritten)
+ * @param error Set to a description of the problem on failure
+ * @return False if the checkpoint could not be read, holds an unknown species or active list, or does not fit the world
+ */
+template <typename WORLD>
+bool RestoreCheckpoint(const std::string & path, WORLD & world, emp::Random & random, std::string & error) {
+    MappedCheckpoint checkpoint;
+    if (!checkpoint.Open(path, error)) return false;
+
+    const CheckpointHeader & header = checkpoint.GetHeader();
+    if (!ResetForRestore(world, header.width, header.height)) {
+        error = "checkpoint dimensions do not match the world: " + path;
+        return false;
+    }
+
+    std::memcpy(static_cast<void *>(&random), checkpoint.GetRandomState(), sizeof(emp::Random));
+    const double * energy = checkpoint.GetEnergy();
+    const uint8_t * species = checkpoint.GetSpecies();
+    for (size_t i = 0; i < world.GetSize(); i++) {
+        if (species[i] != GridWorld::EMPTY) PlaceOrganism(world, random, species[i], energy[i], i);
+    }
+    if (!RestoreListOrder(world, checkpoint)) {
+        error = "checkpoint's active list does not match its grid: " + path;
+        return false;
+    }
+    world.SetStep(header.step);
+    return true;
+}
+
+#endif
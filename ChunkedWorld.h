@@ -0,0 +1,414 @@
+#ifndef CHUNKED_WORLD_H
+#define CHUNKED_WORLD_H
+
+#include "emp/base/Ptr.hpp"
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+#include "emp/math/random_utils.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "GridWorld.h"
+#include "Neighbors.h"
+#include "World.h"
+#include "Mouse.h"
+#include "Owl.h"
+#include "Species.h"
+
+/**
+ * @brief Sparse ecology engine that only stores and visits occupied chunks
+ *
+ * Splits the torus into CHUNK_SIDE x CHUNK_SIDE chunks. A chunk's species,
+ * energy and occupancy bits are allocated when the first organism lands in
+ * it and freed at the end of the step in which it empties, so memory and
+ * per-step work follow the population rather than the grid area; the only
+ * per-area cost left is one pointer per chunk. Positions, species bytes and
+ * the Mouse/Owl rules are the same as GridWorld's.
+ *
+ * The schedule is built from the cells occupied at the start of the step,
+ * in random order, instead of a permutation of every cell. Offspring are
+ * therefore never processed in the step they are born, and the random draws
+ * differ from OrgWorld and GridWorld: trajectories are statistically
+ * equivalent, not identical.
+ */
+class ChunkedWorld {
+    public:
+        static constexpr size_t CHUNK_BITS = 6;                        ///< log2 of the chunk side
+        static constexpr size_t CHUNK_SIDE = size_t(1) << CHUNK_BITS;  ///< Chunk side in cells (one occupancy word per row)
+        static constexpr size_t CHUNK_CELLS = CHUNK_SIDE * CHUNK_SIDE; ///< Cells per chunk
+
+    private:
+        /**
+         * @brief Storage for one allocated chunk
+         */
+        struct Chunk {
+            std::array<uint64_t, CHUNK_SIDE> occupied{};  ///< Bit x of word y is set if local cell (x, y) is occupied
+            std::array<uint8_t, CHUNK_CELLS> species;     ///< Species byte per local cell
+            std::array<double, CHUNK_CELLS> energy{};     ///< Energy per local cell
+            size_t count = 0;                             ///< Occupied cells
+            size_t active_index = 0;                      ///< Position in active_chunks
+
+            Chunk() { species.fill(GridWorld::EMPTY); }
+        };
+
+        /**
+         * @brief A cell's chunk and index inside it
+         */
+        struct CellRef {
+            size_t chunk;  ///< Chunk index
+            size_t local;  ///< Local cell index (row * CHUNK_SIDE + column)
+        };
+
+        emp::Random &random;                    ///< Reference to random number generator
+        size_t width;                           ///< Grid width in cells
+        size_t height;                          ///< Grid height in cells
+        size_t chunks_wide;                     ///< Chunks per chunk row
+        NeighborStencil stencil;                ///< Wrapped neighbor lookups for the grid
+        emp::vector<emp::Ptr<Chunk>> chunks;    ///< Chunk table (nullptr for chunks with no organisms)
+        emp::vector<size_t> active_chunks;      ///< Indices of allocated chunks
+        emp::vector<size_t> schedule;           ///< Reused buffer for the step's action schedule
+        size_t num_orgs = 0;                    ///< Number of occupied cells
+        size_t step = 0;                        ///< Number of UpdateEcology calls so far
+
+    public:
+        /**
+         * @brief Construct an empty ChunkedWorld
+         * @param _random Reference to random number generator
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         */
+        ChunkedWorld(emp::Random &_random, size_t _width, size_t _height) :
+            random(_random), width(_width), height(_height),
+            chunks_wide((_width + CHUNK_SIDE - 1) / CHUNK_SIDE),
+            stencil(_width, _height),
+            chunks(chunks_wide * ((_height + CHUNK_SIDE - 1) / CHUNK_SIDE), nullptr) {}
+
+        ChunkedWorld(const ChunkedWorld &) = delete;
+        ChunkedWorld & operator=(const ChunkedWorld &) = delete;
+
+        /**
+         * @brief Free all allocated chunks
+         */
+        ~ChunkedWorld() {
+            for (size_t c : active_chunks) chunks[c].Delete();
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+        size_t GetSize() const { return width * height; }
+        size_t GetNumOrgs() const { return num_orgs; }
+        size_t GetStep() const { return step; }
+        void SetStep(size_t _step) { step = _step; }
+        size_t GetNumChunks() const { return chunks.size(); }
+        size_t GetNumActiveChunks() const { return active_chunks.size(); }
+
+        /**
+         * @brief Check if a cell holds an organism
+         * @param pos Position index
+         * @return True if the cell is not grass
+         */
+        bool IsOccupied(size_t pos) const { return GetSpecies(pos) != GridWorld::EMPTY; }
+
+        /**
+         * @brief Get the species in a cell
+         * @param pos Position index
+         * @return Species ID, or GridWorld::EMPTY for grass
+         */
+        uint8_t GetSpecies(size_t pos) const {
+            const CellRef cell = Locate(pos);
+            return chunks[cell.chunk] ? chunks[cell.chunk]->species[cell.local] : GridWorld::EMPTY;
+        }
+
+        /**
+         * @brief Get the energy of the organism in a cell
+         * @param pos Position index
+         * @return Energy points (0 for grass)
+         */
+        double GetPoints(size_t pos) const {
+            const CellRef cell = Locate(pos);
+            return chunks[cell.chunk] ? chunks[cell.chunk]->energy[cell.local] : 0.0;
+        }
+
+        /**
+         * @brief Place an organism, replacing anything already in the cell
+         * @param _species Species ID (Mouse::SPECIES_ID or Owl::SPECIES_ID)
+         * @param points Initial energy points
+         * @param pos Position index
+         */
+        void AddOrgAt(int _species, double points, size_t pos) {
+            const CellRef cell = Locate(pos);
+            Chunk & chunk = Acquire(cell.chunk);
+            if (chunk.species[cell.local] == GridWorld::EMPTY) {
+                chunk.occupied[cell.local >> CHUNK_BITS] |= uint64_t(1) << (cell.local & (CHUNK_SIDE - 1));
+                chunk.count++;
+                num_orgs++;
+            }
+            chunk.species[cell.local] = static_cast<uint8_t>(_species);
+            chunk.energy[cell.local] = points;
+        }
+
+        /**
+         * @brief Remove the organism in a cell
+         *
+         * The chunk is kept until the end of the step even if it empties.
+         * @param pos Position index
+         */
+        void RemoveOrganism(size_t pos) {
+            const CellRef cell = Locate(pos);
+            if (!chunks[cell.chunk]) return;
+            Chunk & chunk = *chunks[cell.chunk];
+            if (chunk.species[cell.local] != GridWorld::EMPTY) {
+                chunk.occupied[cell.local >> CHUNK_BITS] &= ~(uint64_t(1) << (cell.local & (CHUNK_SIDE - 1)));
+                chunk.species[cell.local] = GridWorld::EMPTY;
+                chunk.energy[cell.local] = 0.0;
+                chunk.count--;
+                num_orgs--;
+            }
+        }
+
+        /**
+         * @brief Visit every organism, chunk by chunk
+         * @param visit Callable taking (position, species, energy)
+         */
+        template <typename VISIT>
+        void ForEachOrganism(VISIT visit) const {
+            for (size_t c : active_chunks) {
+                ForEachOccupied(c, [&](size_t pos) {
+                    const CellRef cell = Locate(pos);
+                    visit(pos, chunks[c]->species[cell.local], chunks[c]->energy[cell.local]);
+                });
+            }
+        }
+
+        /**
+         * @brief Update all organisms in the world for one simulation step
+         *
+         * Same phases as GridWorld::UpdateEcology, but each pass only walks the
+         * occupancy bits of allocated chunks: process the organisms present at
+         * the start of the step in a random order, sweep out the dead, move
+         * organisms randomly, then free chunks left empty. Chunks are walked
+         * in index order, so a step depends only on the grid and the
+         * generator, not on the order chunks were allocated in, and a world
+         * restored from a checkpoint continues exactly.
+         */
+        void UpdateEcology() {
+            SortActiveChunks();
+            schedule.clear();
+            for (size_t c : active_chunks) {
+                ForEachOccupied(c, [this](size_t pos) { schedule.push_back(pos); });
+            }
+            emp::Shuffle(random, schedule);
+            for (size_t pos : schedule) {
+                RegisteredSpecies::Dispatch(GetSpecies(pos), [&](auto tag) { ProcessCell(tag, pos); });
+            }
+
+            RemoveDeadOrganisms();
+            MoveOrganisms();
+            ReleaseEmptyChunks();
+            step++;
+        }
+
+    private:
+        /**
+         * @brief Find the chunk and local index of a cell
+         * @param pos Position index
+         * @return Chunk and local cell index
+         */
+        CellRef Locate(size_t pos) const {
+            const size_t y = stencil.RowOf(pos);
+            const size_t x = pos - y * width;
+            return {(y >> CHUNK_BITS) * chunks_wide + (x >> CHUNK_BITS),
+                    ((y & (CHUNK_SIDE - 1)) << CHUNK_BITS) | (x & (CHUNK_SIDE - 1))};
+        }
+
+        /**
+         * @brief Get the position index of a local cell
+         * @param chunk Chunk index
+         * @param local Local cell index
+         * @return Position index
+         */
+        size_t PositionOf(size_t chunk, size_t local) const {
+            const size_t x = (chunk % chunks_wide) * CHUNK_SIDE + (local & (CHUNK_SIDE - 1));
+            const size_t y = (chunk / chunks_wide) * CHUNK_SIDE + (local >> CHUNK_BITS);
+            return y * width + x;
+        }
+
+        /**
+         * @brief Get a chunk, allocating it if it has no storage yet
+         * @param c Chunk index
+         * @return The chunk
+         */
+        Chunk & Acquire(size_t c) {
+            if (!chunks[c]) {
+                chunks[c] = emp::NewPtr<Chunk>();
+                chunks[c]->active_index = active_chunks.size();
+                active_chunks.push_back(c);
+            }
+            return *chunks[c];
+        }
+
+        /**
+         * @brief Put the allocated chunks in index order
+         */
+        void SortActiveChunks() {
+            std::sort(active_chunks.begin(), active_chunks.end());
+            for (size_t i = 0; i < active_chunks.size(); i++) chunks[active_chunks[i]]->active_index = i;
+        }
+
+        /**
+         * @brief Free every allocated chunk that holds no organisms
+         */
+        void ReleaseEmptyChunks() {
+            for (size_t i = 0; i < active_chunks.size();) {
+                const size_t c = active_chunks[i];
+                if (chunks[c]->count > 0) {
+                    i++;
+                    continue;
+                }
+                chunks[c].Delete();
+                chunks[c] = nullptr;
+                active_chunks[i] = active_chunks.back();
+                active_chunks.pop_back();
+                if (i < active_chunks.size()) chunks[active_chunks[i]]->active_index = i;
+            }
+        }
+
+        /**
+         * @brief Visit the occupied cells of a chunk in row order
+         *
+         * Occupancy is re-read after every visit, so cells filled ahead of the
+         * current one during the walk are visited too (like an index-order loop
+         * over a dense grid).
+         * @param c Chunk index (must be allocated)
+         * @param visit Callable taking a position index
+         */
+        template <typename VISIT>
+        void ForEachOccupied(size_t c, VISIT visit) const {
+            const Chunk & chunk = *chunks[c];
+            for (size_t row = 0; row < CHUNK_SIDE; row++) {
+                uint64_t bits = chunk.occupied[row];
+                while (bits) {
+                    const size_t col = static_cast<size_t>(__builtin_ctzll(bits));
+                    visit(PositionOf(c, (row << CHUNK_BITS) | col));
+                    bits = col + 1 < CHUNK_SIDE ? chunk.occupied[row] & (~uint64_t(0) << (col + 1)) : 0;
+                }
+            }
+        }
+
+        /**
+         * @brief Find the first empty neighbor of a cell
+         * @param pos Center position
+         * @return Empty neighbor position, or GetSize() if none
+         */
+        size_t FindEmptyNeighbor(size_t pos) const {
+            for (size_t n : stencil.Around(pos)) {
+                if (!IsOccupied(n)) return n;
+            }
+            return GetSize();
+        }
+
+        /**
+         * @brief Apply the Mouse rules to the mouse in a cell
+         * @param pos Position of the mouse
+         */
+        void ProcessCell(SpeciesTag<Mouse>, size_t pos) {
+            int grass_count = 0;
+            for (size_t n : stencil.Around(pos)) {
+                grass_count += !IsOccupied(n);
+            }
+
+            double points = GetPoints(pos);
+            if (grass_count > 0) points += Mouse::CalculateGrassBonus(grass_count);
+            points -= Mouse::METABOLISM_COST;
+
+            if (points >= Mouse::REPRODUCTION_THRESHOLD) {
+                const size_t child_pos = FindEmptyNeighbor(pos);
+                if (child_pos != GetSize()) {
+                    AddOrgAt(Mouse::SPECIES_ID, Mouse::OFFSPRING_ENERGY, child_pos);
+                    points -= Mouse::REPRODUCTION_COST;
+                }
+            }
+            SetPoints(pos, points);
+        }
+
+        /**
+         * @brief Apply the Owl rules to the owl in a cell
+         * @param pos Position of the owl
+         */
+        void ProcessCell(SpeciesTag<Owl>, size_t pos) {
+            NeighborList prey;
+            for (size_t n : stencil.Around(pos)) {
+                if (GetSpecies(n) == Mouse::SPECIES_ID) prey.Push(n);
+            }
+
+            // As in GridWorld, the owl moves onto its prey but places offspring
+            // around the cell it started the turn in.
+            size_t owl_pos = pos;
+            double points = GetPoints(pos);
+            if (!prey.empty()) {
+                const size_t target = prey[random.GetUInt(prey.size())];
+                points += Owl::CalculateHuntReward(GetPoints(target));
+                RemoveOrganism(pos);
+                RemoveOrganism(target);
+                AddOrgAt(Owl::SPECIES_ID, points, target);
+                owl_pos = target;
+                points -= Owl::HUNTING_COST;
+            } else {
+                points -= Owl::STARVATION_COST;
+            }
+
+            if (points >= Owl::REPRODUCTION_THRESHOLD) {
+                const size_t child_pos = FindEmptyNeighbor(pos);
+                if (child_pos != GetSize()) {
+                    AddOrgAt(Owl::SPECIES_ID, Owl::OFFSPRING_ENERGY, child_pos);
+                    points -= Owl::REPRODUCTION_COST;
+                }
+            }
+            SetPoints(owl_pos, points);
+        }
+
+        /**
+         * @brief Overwrite the energy of an occupied cell
+         * @param pos Position index (must be occupied)
+         * @param points New energy points
+         */
+        void SetPoints(size_t pos, double points) {
+            const CellRef cell = Locate(pos);
+            chunks[cell.chunk]->energy[cell.local] = points;
+        }
+
+        /**
+         * @brief Remove dead organisms from the allocated chunks
+         */
+        void RemoveDeadOrganisms() {
+            for (size_t c : active_chunks) {
+                ForEachOccupied(c, [this](size_t pos) {
+                    if (GetPoints(pos) <= 0) RemoveOrganism(pos);
+                });
+            }
+        }
+
+        /**
+         * @brief Move organisms randomly based on movement probability
+         *
+         * Same draws per organism as GridWorld::MoveOrganisms. Chunks first
+         * entered during this pass are not walked again.
+         */
+        void MoveOrganisms() {
+            const size_t num_active = active_chunks.size();
+            for (size_t i = 0; i < num_active; i++) {
+                ForEachOccupied(active_chunks[i], [this](size_t pos) {
+                    if (!random.P(OrgWorld::MOVE_PROBABILITY)) return;
+                    const size_t target = stencil.InBlock(pos, random.GetUInt(9));
+                    if (IsOccupied(target)) return;
+                    const uint8_t species = GetSpecies(pos);
+                    const double points = GetPoints(pos);
+                    RemoveOrganism(pos);
+                    AddOrgAt(species, points, target);
+                });
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef COUNTER_RANDOM_H
+#define COUNTER_RANDOM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief What a counter-based draw is used for
+ *
+ * Part of the key, so draws for different decisions about the same cell in
+ * the same step are independent.
+ */
+enum class RandomPurpose : uint32_t {
+    SCHEDULE = 0,      ///< Position in the step's processing order
+    PREY = 1,          ///< Which neighboring mouse an owl hunts
+    MOVE = 2,          ///< Whether an organism tries to move
+    MOVE_TARGET = 3,   ///< Which cell of the 3x3 block it tries to move to
+    MOVE_PRIORITY = 4, ///< Rank of a two-phase move proposal among rivals for the same cell
+    HUNT_PRIORITY = 5, ///< Rank of a synchronous hunt among owls after the same mouse
+    BIRTH_PRIORITY = 6 ///< Rank of a synchronous offspring placement among parents after the same cell
+};
+
+/**
+ * @brief Stateless random numbers keyed by (seed, step, cell, purpose)
+ *
+ * Each draw runs the Philox4x32-10 block cipher on the step and cell,
+ * keyed by the seed and the purpose. The result depends only on those four
+ * values, never on how many draws came before, so cells can be processed
+ * on any thread and in any order and still get the same numbers.
+ */
+class CounterRandom {
+    private:
+        uint32_t seed = 0; ///< First key word of every draw
+
+    public:
+        CounterRandom() = default;
+
+        /**
+         * @brief Construct a generator
+         * @param _seed Seed shared by every draw
+         */
+        explicit CounterRandom(uint32_t _seed) : seed(_seed) {}
+
+        uint32_t GetSeed() const { return seed; }
+        void SetSeed(uint32_t _seed) { seed = _seed; }
+
+        /**
+         * @brief Run Philox4x32-10 on one counter block
+         * @param counter Four counter words
+         * @param key Two key words
+         * @return Four pseudorandom words
+         */
+        static std::array<uint32_t, 4> Philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+            for (int round = 0; round < 10; round++) {
+                const uint64_t p0 = uint64_t(0xD2511F53) * counter[0];
+                const uint64_t p1 = uint64_t(0xCD9E8D57) * counter[2];
+                counter = {static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(p1),
+                           static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(p0)};
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+            return counter;
+        }
+
+        /**
+         * @brief Get 64 random bits for one decision
+         * @param step Simulation step
+         * @param cell Position index the decision is about
+         * @param purpose What the draw is for
+         * @return Random bits
+         */
+        uint64_t GetBits(uint64_t step, uint64_t cell, RandomPurpose purpose) const {
+            const std::array<uint32_t, 4> out = Philox(
+                {static_cast<uint32_t>(cell), static_cast<uint32_t>(cell >> 32),
+                 static_cast<uint32_t>(step), static_cast<uint32_t>(step >> 32)},
+                {seed, static_cast<uint32_t>(purpose)});
+            return (uint64_t(out[0]) << 32) | out[1];
+        }
+
+        /**
+         * @brief Draw an integer in [0, n)
+         * @param step Simulation step
+         * @param cell Position index the decision is about
+         * @param purpose What the draw is for
+         * @param n Number of outcomes (at least 1)
+         * @return Value in [0, n)
+         */
+        size_t GetUInt(uint64_t step, uint64_t cell, RandomPurpose purpose, size_t n) const {
+            return static_cast<size_t>((static_cast<unsigned __int128>(GetBits(step, cell, purpose)) * n) >> 64);
+        }
+
+        /**
+         * @brief Draw a double in [0, 1)
+         * @param step Simulation step
+         * @param cell Position index the decision is about
+         * @param purpose What the draw is for
+         * @return Uniform value with 53 random bits
+         */
+        double GetDouble(uint64_t step, uint64_t cell, RandomPurpose purpose) const {
+            return static_cast<double>(GetBits(step, cell, purpose) >> 11) * 0x1.0p-53;
+        }
+
+        /**
+         * @brief Draw a yes/no outcome
+         * @param step Simulation step
+         * @param cell Position index the decision is about
+         * @param purpose What the draw is for
+         * @param probability Chance of true
+         * @return True with the given probability
+         */
+        bool P(uint64_t step, uint64_t cell, RandomPurpose purpose, double probability) const {
+            return GetDouble(step, cell, purpose) < probability;
+        }
+
+        /**
+         * @brief Shuffle a list with Fisher-Yates draws keyed by slot
+         *
+         * The draw for slot k is keyed by first_slot + k, never by the item in
+         * the slot: an item moved forward by one swap would otherwise be keyed
+         * again with the same value when its new slot came up, and the
+         * permutation would not be uniform. Callers shuffling several lists
+         * in one step pass disjoint slot ranges.
+         * @param step Simulation step
+         * @param first_slot Key of the list's first slot
+         * @param items List to shuffle in place
+         */
+        template <typename CONTAINER>
+        void Shuffle(uint64_t step, uint64_t first_slot, CONTAINER & items) const {
+            const size_t n = items.size();
+            for (size_t k = 0; k + 1 < n; k++) {
+                const size_t j = k + GetUInt(step, first_slot + k, RandomPurpose::SCHEDULE, n - k);
+                std::swap(items[k], items[j]);
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,334 @@
+#ifndef DETECTORS_H
+#define DETECTORS_H
+
+#include "emp/base/vector.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include "Setup.h"
+
+/**
+ * @brief What a replicate does once a detector fires
+ */
+enum class DetectorAction {
+    RUN,          ///< Keep stepping as if nothing happened
+    STOP,         ///< End the replicate at this step
+    FAST_FORWARD  ///< Fill the remaining steps from a projection instead of stepping
+};
+
+/**
+ * @brief Parse a detector action name
+ * @param name "run", "stop" or "fast-forward"
+ * @param action Set to the parsed action
+ * @return False if the name is unknown
+ */
+inline bool ParseDetectorAction(const std::string & name, DetectorAction & action) {
+    if (name == "run") action = DetectorAction::RUN;
+    else if (name == "stop") action = DetectorAction::STOP;
+    else if (name == "fast-forward") action = DetectorAction::FAST_FORWARD;
+    else return false;
+    return true;
+}
+
+/**
+ * @brief Mean and variance of species counts over the two most recent windows
+ *
+ * Keeps the last 2 * window samples in a ring with running sums, so adding
+ * a sample costs the same for any window length.
+ */
+class CountWindow {
+    public:
+        using Counts = std::array<size_t, RegisteredSpecies::SIZE>; ///< Organisms per species
+
+    private:
+        size_t window;                   ///< Samples per window
+        emp::vector<Counts> samples;     ///< Last 2 * window samples, oldest overwritten first
+        size_t seen = 0;                 ///< Samples added so far
+        std::array<std::array<double, RegisteredSpecies::SIZE>, 2> sums = {};    ///< Per-window sums (0 = older)
+        std::array<std::array<double, RegisteredSpecies::SIZE>, 2> squares = {}; ///< Per-window sums of squares
+
+    public:
+        /**
+         * @brief Construct an empty window pair
+         * @param _window Samples per window (at least 1)
+         */
+        explicit CountWindow(size_t _window) : window(_window > 0 ? _window : 1), samples(2 * window) {}
+
+        /**
+         * @brief Add the newest sample, moving older ones back a window
+         * @param counts Organisms per species
+         */
+        void Add(const Counts & counts) {
+            const size_t ring = samples.size();
+            if (seen >= ring) Account(0, samples[seen % ring], -1.0);
+            if (seen >= window) {
+                Account(1, samples[(seen - window) % ring], -1.0);
+                Account(0, samples[(seen - window) % ring], 1.0);
+            }
+            samples[seen % ring] = counts;
+            Account(1, counts, 1.0);
+            seen++;
+        }
+
+        /**
+         * @brief Check whether both windows hold a full set of samples
+         * @return True once 2 * window samples have been added
+         */
+        bool IsFull() const { return seen >= samples.size(); }
+
+        /**
+         * @brief Get a species' mean count over one window
+         * @param recent True for the newest window, false for the one before it
+         * @param species Species ID
+         * @return Mean count (valid once the window is full)
+         */
+        double GetMean(bool recent, size_t species) const { return sums[recent][species] / window; }
+
+        /**
+         * @brief Get the sample variance of a species' count over one window
+         * @param recent True for the newest window, false for the one before it
+         * @param species Species ID
+         * @return Variance (0 for a one-sample window)
+         */
+        double GetVariance(bool recent, size_t species) const {
+            if (window < 2) return 0.0;
+            const double mean = GetMean(recent, species);
+            const double variance = (squares[recent][species] - window * mean * mean) / (window - 1);
+            return variance > 0.0 ? variance : 0.0;
+        }
+
+    private:
+        /**
+         * @brief Add a sample to (or take it out of) one window's sums
+         * @param half 0 for the older window, 1 for the newest
+         * @param counts The sample
+         * @param sign 1 to add, -1 to remove
+         */
+        void Account(size_t half, const Counts & counts, double sign) {
+            for (size_t s = 0; s < counts.size(); s++) {
+                const double count = static_cast<double>(counts[s]);
+                sums[half][s] += sign * count;
+                squares[half][s] += sign * count * count;
+            }
+        }
+};
+
+/**
+ * @brief Projection of a world whose mice have died out
+ *
+ * With no prey left, every owl loses Owl::STARVATION_COST each step, breeds
+ * while it can afford to and dies at zero energy, so the owl count follows
+ * from the owls' energies alone. Offspring are assumed to find room and to
+ * act from the next step, as with the active-list schedule.
+ */
+class OwlDecay {
+    private:
+        emp::vector<double> energies;  ///< Energy of every living owl
+
+    public:
+        /**
+         * @brief Take the energies of every owl in a world
+         * @param world OrgWorld, GridWorld or any world GetCellSpecies accepts
+         */
+        template <typename WORLD>
+        void Capture(const WORLD & world) {
+            energies.clear();
+            for (size_t i = 0; i < world.GetSize(); i++) {
+                if (GetCellSpecies(world, i) == Owl::SPECIES_ID) energies.push_back(GetCellPoints(world, i));
+            }
+        }
+
+        /**
+         * @brief Advance every owl one step
+         * @return Owls alive after the step
+         */
+        size_t Step() {
+            const size_t parents = energies.size();
+            for (size_t i = 0; i < parents; i++) {
+                energies[i] -= Owl::STARVATION_COST;
+                if (energies[i] >= Owl::REPRODUCTION_THRESHOLD) {
+                    energies[i] -= Owl::REPRODUCTION_COST;
+                    energies.push_back(Owl::OFFSPRING_ENERGY);
+                }
+            }
+            size_t alive = 0;
+            for (double energy : energies) {
+                if (energy > 0) energies[alive++] = energy;
+            }
+            energies.resize(alive);
+            return alive;
+        }
+};
+
+/**
+ * @brief Watches a replicate's species counts for states not worth stepping through
+ *
+ * Three detectors run on the counts after every step, in this order:
+ * - absorbing: the world is empty (all grass), so it never changes again;
+ * - extinction: a species that was present has died out;
+ * - steady state: over the two most recent windows of steady_window steps,
+ *   every species' mean count differs by at most steady_tolerance times the
+ *   pooled standard deviation of the counts.
+ *
+ * Each detector's action says whether the replicate keeps running, stops,
+ * or fast-forwards: an empty world stays empty, a world without mice
+ * follows OwlDecay, and a steady state holds the newest window's mean.
+ * Extinction of owls alone has no projection, so fast-forward keeps
+ * running it until the mice die out too. The first detector to stop or
+ * fast-forward ends the replicate.
+ */
+class ReplicateMonitor {
+    public:
+        using Counts = CountWindow::Counts; ///< Organisms per species
+
+        /**
+         * @brief The state a detector found
+         */
+        enum class Detection { NONE, ABSORBING, EXTINCTION, STEADY_STATE };
+
+        /**
+         * @brief Detector actions and steady-state parameters
+         */
+        struct Settings {
+            DetectorAction on_absorbing = DetectorAction::RUN;   ///< Action for an empty world
+            DetectorAction on_extinction = DetectorAction::RUN;  ///< Action once a species dies out
+            DetectorAction on_steady = DetectorAction::RUN;      ///< Action once counts are stationary
+            size_t steady_window = 500;                          ///< Steps per steady-state window
+            double steady_tolerance = 0.25;                      ///< Largest mean difference, in standard deviations
+        };
+
+    private:
+        Settings settings;                            ///< Detector configuration
+        CountWindow history;                          ///< Recent counts for the steady-state test
+        std::array<bool, RegisteredSpecies::SIZE> present = {}; ///< Species seen alive so far
+        std::array<bool, RegisteredSpecies::SIZE> extinct = {}; ///< Species seen dying out so far
+        Detection detection = Detection::NONE;        ///< Detector that ended the replicate
+        Counts last = {};                             ///< Counts at the last observed step
+
+    public:
+        /**
+         * @brief Construct a monitor for one replicate
+         * @param _settings Detector actions and steady-state parameters
+         */
+        explicit ReplicateMonitor(const Settings & _settings) :
+            settings(_settings), history(_settings.steady_window) {}
+
+        /**
+         * @brief Check whether any detector can end the replicate
+         * @return False if every action is RUN
+         */
+        bool IsActive() const {
+            return settings.on_absorbing != DetectorAction::RUN || settings.on_extinction != DetectorAction::RUN
+                || settings.on_steady != DetectorAction::RUN;
+        }
+
+        /**
+         * @brief Run the detectors on one step's counts
+         * @param counts Organisms per species after the step
+         * @return What the replicate should do now
+         */
+        DetectorAction Observe(const Counts & counts) {
+            last = counts;
+            size_t total = 0;
+            bool died_out = false;
+            for (size_t s = 0; s < counts.size(); s++) {
+                total += counts[s];
+                if (counts[s] > 0) present[s] = true;
+                else if (present[s] && !extinct[s]) died_out = extinct[s] = true;
+            }
+
+            if (total == 0 && settings.on_absorbing != DetectorAction::RUN) {
+                return Fire(Detection::ABSORBING, settings.on_absorbing);
+            }
+
+            if (died_out) {
+                DetectorAction action = settings.on_extinction;
+                if (action == DetectorAction::FAST_FORWARD && counts[Mouse::SPECIES_ID] > 0) action = DetectorAction::RUN;
+                if (action != DetectorAction::RUN) return Fire(Detection::EXTINCTION, action);
+            }
+
+            if (settings.on_steady == DetectorAction::RUN) return DetectorAction::RUN;
+            history.Add(counts);
+            if (!IsSteady()) return DetectorAction::RUN;
+            return Fire(Detection::STEADY_STATE, settings.on_steady);
+        }
+
+        /**
+         * @brief Get the detector that ended the replicate
+         * @return NONE while the replicate is still running
+         */
+        Detection GetDetection() const { return detection; }
+
+        /**
+         * @brief Get a detection's name
+         * @param detection Detection to name
+         * @return "none", "absorbing", "extinction" or "steady-state"
+         */
+        static const char * GetName(Detection detection) {
+            switch (detection) {
+                case Detection::ABSORBING: return "absorbing";
+                case Detection::EXTINCTION: return "extinction";
+                case Detection::STEADY_STATE: return "steady-state";
+                default: return "none";
+            }
+        }
+
+        /**
+         * @brief Project the counts of the steps after a fast-forward
+         * @param world The replicate's world, at the step that fired
+         * @param steps Steps to project
+         * @param on_step Receives (steps after the firing step, counts) for 1 to steps
+         */
+        template <typename WORLD, typename CALLBACK>
+        void FastForward(const WORLD & world, size_t steps, CALLBACK && on_step) const {
+            Counts counts = {};
+            if (detection == Detection::STEADY_STATE) {
+                for (size_t s = 0; s < counts.size(); s++) {
+                    counts[s] = static_cast<size_t>(std::llround(history.GetMean(true, s)));
+                }
+            }
+            if (detection != Detection::EXTINCTION) {
+                for (size_t step = 1; step <= steps; step++) on_step(step, counts);
+                return;
+            }
+
+            // Only a world without mice fast-forwards on extinction
+            counts = last;
+            OwlDecay owls;
+            owls.Capture(world);
+            for (size_t step = 1; step <= steps; step++) {
+                counts[Owl::SPECIES_ID] = owls.Step();
+                on_step(step, counts);
+            }
+        }
+
+    private:
+        /**
+         * @brief Record the detector that ended the replicate
+         * @param found State the detector found
+         * @param action Its action (not RUN)
+         * @return The action
+         */
+        DetectorAction Fire(Detection found, DetectorAction action) {
+            detection = found;
+            return action;
+        }
+
+        /**
+         * @brief Apply the steady-state test to the two most recent windows
+         * @return True if every species' mean moved less than the tolerance allows
+         */
+        bool IsSteady() const {
+            if (!history.IsFull()) return false;
+            for (size_t s = 0; s < RegisteredSpecies::SIZE; s++) {
+                const double shift = std::abs(history.GetMean(true, s) - history.GetMean(false, s));
+                const double spread = std::sqrt((history.GetVariance(true, s) + history.GetVariance(false, s)) / 2);
+                if (shift > settings.steady_tolerance * spread) return false;
+            }
+            return true;
+        }
+};
+
+#endif
@@ -0,0 +1,962 @@
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "CounterRandom.h"
+#include "Neighbors.h"
+#include "Setup.h"
+#include "Species.h"
+
+/**
+ * @brief Ordered message passing between the processes of a distributed run
+ *
+ * Endpoints are numbered 0 to GetNumEndpoints() - 1, and messages from one
+ * endpoint to another arrive in the order they were sent. Strip workers
+ * talk to each other and to the coordinator only through this interface,
+ * so a socket transport can replace the shared-memory one without touching
+ * them.
+ */
+class Transport {
+    public:
+        virtual ~Transport() = default;
+
+        /**
+         * @brief Get the endpoint this process speaks for
+         * @return Endpoint index
+         */
+        virtual size_t GetRank() const = 0;
+
+        /**
+         * @brief Get the number of endpoints
+         * @return Endpoint count
+         */
+        virtual size_t GetNumEndpoints() const = 0;
+
+        /**
+         * @brief Send a message, waiting for buffer space if needed
+         * @param to Destination endpoint (may be this endpoint)
+         * @param message Bytes to send
+         * @return False if the transport was aborted
+         */
+        virtual bool Send(size_t to, const emp::vector<uint8_t> & message) = 0;
+
+        /**
+         * @brief Receive the next message from an endpoint, waiting until it arrives
+         * @param from Source endpoint (may be this endpoint)
+         * @param message Set to the received bytes
+         * @return False if the transport was aborted
+         */
+        virtual bool Receive(size_t from, emp::vector<uint8_t> & message) = 0;
+
+        /**
+         * @brief Make every pending and future Send and Receive on every endpoint fail
+         */
+        virtual void Abort() = 0;
+};
+
+/**
+ * @brief Transport over one shared anonymous mapping for forked processes
+ *
+ * Create it before forking, then call SetRank in each process. Every
+ * ordered pair of endpoints has its own single-producer single-consumer
+ * ring buffer with atomic read and write cursors, so no locks are taken.
+ * Messages are streamed through the ring, so they may be larger than it,
+ * but the capacity must hold everything a sender writes before it next
+ * receives, or the exchange deadlocks. Pages are only touched for channels
+ * that carry traffic.
+ */
+class SharedMemoryTransport : public Transport {
+    private:
+        static constexpr size_t SPINS_BEFORE_YIELD = 64;   ///< Busy polls before giving up the CPU
+        static constexpr size_t SPINS_PER_IDLE_CHECK = 4096; ///< Polls between calls to the idle check
+
+        /**
+         * @brief A cursor on its own cache line so reader and writer do not share one
+         */
+        struct alignas(64) Cursor {
+            std::atomic<uint64_t> value; ///< Total bytes written or read
+        };
+
+        /**
+         * @brief Cursors of one ring buffer
+         */
+        struct Channel {
+            Cursor written; ///< Advanced by the sender
+            Cursor read;    ///< Advanced by the receiver
+        };
+
+        size_t num_endpoints;                      ///< Number of endpoints
+        size_t capacity;                           ///< Ring size per channel in bytes
+        size_t rank = 0;                           ///< Endpoint of this process
+        size_t mapping_size = 0;                   ///< Bytes mapped
+        void * mapping = MAP_FAILED;               ///< Shared mapping
+        std::atomic<uint32_t> * aborted = nullptr; ///< Set once by Abort, seen by every process
+        Channel * channels = nullptr;              ///< Cursors, indexed from * num_endpoints + to
+        uint8_t * buffers = nullptr;               ///< Ring data, capacity bytes per channel
+        std::function<bool()> idle_check;          ///< Polled while waiting; false aborts
+
+    public:
+        /**
+         * @brief Map the shared channels
+         * @param _num_endpoints Number of endpoints
+         * @param _capacity Ring size per channel in bytes
+         */
+        SharedMemoryTransport(size_t _num_endpoints, size_t _capacity) :
+            num_endpoints(_num_endpoints), capacity(_capacity) {
+            const size_t num_channels = num_endpoints * num_endpoints;
+            const size_t header_size = sizeof(Channel) * (1 + num_channels);
+            mapping_size = header_size + num_channels * capacity;
+            mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+            if (mapping == MAP_FAILED) return;
+
+            // The first slot holds the abort flag; anonymous pages start zeroed
+            uint8_t * base = static_cast<uint8_t *>(mapping);
+            aborted = new (base) std::atomic<uint32_t>(0);
+            channels = reinterpret_cast<Channel *>(base + sizeof(Channel));
+            for (size_t i = 0; i < num_channels; i++) {
+                new (&channels[i].written.value) std::atomic<uint64_t>(0);
+                new (&channels[i].read.value) std::atomic<uint64_t>(0);
+            }
+            buffers = base + header_size;
+        }
+
+        SharedMemoryTransport(const SharedMemoryTransport &) = delete;
+        SharedMemoryTransport & operator=(const SharedMemoryTransport &) = delete;
+
+        /**
+         * @brief Unmap this process's view of the channels
+         */
+        ~SharedMemoryTransport() {
+            if (mapping != MAP_FAILED) munmap(mapping, mapping_size);
+        }
+
+        /**
+         * @brief Check that the mapping was created
+         * @return True if the transport can be used
+         */
+        bool IsOpen() const { return mapping != MAP_FAILED; }
+
+        /**
+         * @brief Choose the endpoint this process speaks for (after forking)
+         * @param _rank Endpoint index
+         */
+        void SetRank(size_t _rank) { rank = _rank; }
+
+        /**
+         * @brief Set a check polled while this process waits
+         *
+         * The coordinator uses it to notice a worker that died without
+         * aborting; returning false aborts the transport.
+         * @param check Returns false when waiting is pointless
+         */
+        void SetIdleCheck(std::function<bool()> check) { idle_check = std::move(check); }
+
+        size_t GetRank() const override { return rank; }
+        size_t GetNumEndpoints() const override { return num_endpoints; }
+
+        /**
+         * @brief Send a length-prefixed message
+         * @param to Destination endpoint
+         * @param message Bytes to send
+         * @return False if the transport was aborted
+         */
+        bool Send(size_t to, const emp::vector<uint8_t> & message) override {
+            const uint64_t size = message.size();
+            return WriteBytes(to, reinterpret_cast<const uint8_t *>(&size), sizeof(size))
+                && WriteBytes(to, message.data(), message.size());
+        }
+
+        /**
+         * @brief Receive a length-prefixed message
+         * @param from Source endpoint
+         * @param message Set to the received bytes
+         * @return False if the transport was aborted
+         */
+        bool Receive(size_t from, emp::vector<uint8_t> & message) override {
+            uint64_t size = 0;
+            if (!ReadBytes(from, reinterpret_cast<uint8_t *>(&size), sizeof(size))) return false;
+            message.resize(size);
+            return ReadBytes(from, message.data(), message.size());
+        }
+
+        /**
+         * @brief Abort the transport for every process sharing it
+         */
+        void Abort() override {
+            if (aborted) aborted->store(1, std::memory_order_relaxed);
+        }
+
+    private:
+        /**
+         * @brief Wait a little for the other side of a channel
+         * @param spins Polls so far for this wait
+         * @return False if the transport was aborted
+         */
+        bool Wait(size_t & spins) {
+            if (aborted->load(std::memory_order_relaxed)) return false;
+            spins++;
+            if (spins % SPINS_PER_IDLE_CHECK == 0 && idle_check && !idle_check()) {
+                Abort();
+                return false;
+            }
+            if (spins > SPINS_BEFORE_YIELD) sched_yield();
+            return true;
+        }
+
+        /**
+         * @brief Stream bytes into the ring to another endpoint
+         * @param to Destination endpoint
+         * @param data Bytes to write
+         * @param size Number of bytes
+         * @return False if the transport was aborted
+         */
+        bool WriteBytes(size_t to, const uint8_t * data, size_t size) {
+            Channel & channel = channels[rank * num_endpoints + to];
+            uint8_t * ring = buffers + (rank * num_endpoints + to) * capacity;
+            uint64_t written = channel.written.value.load(std::memory_order_relaxed);
+            size_t spins = 0;
+            while (size > 0) {
+                const uint64_t read = channel.read.value.load(std::memory_order_acquire);
+                const size_t space = capacity - static_cast<size_t>(written - read);
+                if (space == 0) {
+                    if (!Wait(spins)) return false;
+                    continue;
+                }
+                const size_t offset = static_cast<size_t>(written % capacity);
+                const size_t chunk = std::min({size, space, capacity - offset});
+                std::memcpy(ring + offset, data, chunk);
+                data += chunk;
+                size -= chunk;
+                written += chunk;
+                channel.written.value.store(written, std::memory_order_release);
+                spins = 0;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Stream bytes out of the ring from another endpoint
+         * @param from Source endpoint
+         * @param data Destination for the bytes
+         * @param size Number of bytes
+         * @return False if the transport was aborted
+         */
+        bool ReadBytes(size_t from, uint8_t * data, size_t size) {
+            Channel & channel = channels[from * num_endpoints + rank];
+            const uint8_t * ring = buffers + (from * num_endpoints + rank) * capacity;
+            uint64_t read = channel.read.value.load(std::memory_order_relaxed);
+            size_t spins = 0;
+            while (size > 0) {
+                const uint64_t written = channel.written.value.load(std::memory_order_acquire);
+                const size_t available = static_cast<size_t>(written - read);
+                if (available == 0) {
+                    if (!Wait(spins)) return false;
+                    continue;
+                }
+                const size_t offset = static_cast<size_t>(read % capacity);
+                const size_t chunk = std::min({size, available, capacity - offset});
+                std::memcpy(data, ring + offset, chunk);
+                data += chunk;
+                size -= chunk;
+                read += chunk;
+                channel.read.value.store(read, std::memory_order_release);
+                spins = 0;
+            }
+            return true;
+        }
+};
+
+/**
+ * @brief Append a plain value to a message
+ * @param message Message being built
+ * @param value Value to append (copied byte for byte)
+ */
+template <typename T>
+void AppendValue(emp::vector<uint8_t> & message, const T & value) {
+    const size_t at = message.size();
+    message.resize(at + sizeof(T));
+    std::memcpy(message.data() + at, &value, sizeof(T));
+}
+
+/**
+ * @brief Read a plain value from a message
+ * @param message Message being read
+ * @param at Read offset, advanced past the value
+ * @return The value
+ */
+template <typename T>
+T ReadValue(const emp::vector<uint8_t> & message, size_t & at) {
+    T value;
+    std::memcpy(&value, message.data() + at, sizeof(T));
+    at += sizeof(T);
+    return value;
+}
+
+/**
+ * @brief One worker's horizontal strip of a distributed grid
+ *
+ * Owns whole rows of tiles, stored with a ghost row above and below that
+ * mirror the neighboring strips. Runs OrgWorld's COUNTER-mode tiled update
+ * on flat arrays: the same tiles and colors, the same keyed draws and the
+ * same rules, so a distributed run reproduces OrgWorld with
+ * SetRandomMode(COUNTER, seed) and the same tile side, for any number of
+ * workers.
+ *
+ * A tile only reads and writes cells within one cell of itself, and tiles
+ * are at least MIN_TILE_SIDE rows tall, so while one color runs no worker
+ * writes the boundary row its neighbor is reading. Owls that hunt across
+ * the boundary, offspring placed across it and organisms that move across
+ * it are written into the ghost row and handed to the owning worker in the
+ * exchange after the phase, together with the sender's own boundary row
+ * to refresh the receiver's ghost.
+ */
+class StripWorld {
+    public:
+        static constexpr uint8_t EMPTY = 0xFF; ///< Species byte of a grass (empty) cell (same as GridWorld)
+
+        /**
+         * @brief Which way a halo message travels
+         */
+        enum Direction : uint32_t {
+            UP = 0,  ///< To the strip above (it carries the sender's top row)
+            DOWN = 1 ///< To the strip below (it carries the sender's bottom row)
+        };
+
+    private:
+        /**
+         * @brief A tile of the strip
+         */
+        struct StripTile {
+            size_t x0, x1;     ///< Column range [x0, x1)
+            size_t y0, y1;     ///< Global row range [y0, y1)
+            size_t color;      ///< Phase in which this tile runs (0-3), as in OrgWorld
+            size_t index;      ///< Position in the whole grid's row-major tile order, as in OrgWorld
+        };
+
+        /**
+         * @brief A ghost cell this worker changed during a phase
+         */
+        struct GhostChange {
+            uint32_t x;        ///< Column
+            uint8_t species;   ///< New species byte
+            double energy;     ///< New energy
+        };
+
+        Transport & transport;         ///< Link to the other strips
+        size_t width;                  ///< Grid width in cells
+        size_t height;                 ///< Grid height in cells
+        size_t first_row;              ///< First owned global row
+        size_t num_rows;               ///< Owned rows
+        size_t up_rank;                ///< Worker owning the rows above
+        size_t down_rank;              ///< Worker owning the rows below
+        emp::vector<uint8_t> species;  ///< Species byte per local cell (local row 0 and num_rows + 1 are ghosts)
+        emp::vector<double> energy;    ///< Energy per local cell
+        emp::vector<uint8_t> ghost_species; ///< Both ghost rows as of the last exchange
+        emp::vector<double> ghost_energy;   ///< Both ghost rows' energies as of the last exchange
+        std::array<emp::vector<GhostChange>, 2> changes; ///< Ghost changes being handed off, by Direction
+        NeighborStencil stencil;       ///< Neighbor lookups in local indices (owned rows never wrap vertically)
+        emp::vector<StripTile> tiles;  ///< Owned tiles
+        emp::vector<size_t> cells;     ///< Reused schedule buffer (global indices)
+        emp::vector<uint8_t> message;  ///< Reused message buffer
+        CounterRandom counter_random;  ///< Keyed generator for every decision
+        size_t step = 0;               ///< Number of UpdateEcology calls so far
+
+    public:
+        /**
+         * @brief Construct a worker's strip
+         * @param _transport Link to the other strips
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         * @param tiles_x Tiles across the grid (even)
+         * @param tiles_y Tiles down the grid (even)
+         * @param first_tile_row First tile row owned
+         * @param end_tile_row One past the last tile row owned
+         * @param seed Seed of the keyed generator
+         * @param _up_rank Worker owning the rows above
+         * @param _down_rank Worker owning the rows below
+         */
+        StripWorld(Transport & _transport, size_t _width, size_t _height, size_t tiles_x, size_t tiles_y,
+                   size_t first_tile_row, size_t end_tile_row, uint32_t seed, size_t _up_rank, size_t _down_rank) :
+            transport(_transport), width(_width), height(_height),
+            first_row(first_tile_row * _height / tiles_y),
+            num_rows(end_tile_row * _height / tiles_y - first_tile_row * _height / tiles_y),
+            up_rank(_up_rank), down_rank(_down_rank),
+            species((num_rows + 2) * _width, EMPTY), energy((num_rows + 2) * _width, 0.0),
+            ghost_species(2 * _width, EMPTY), ghost_energy(2 * _width, 0.0),
+            stencil(_width, num_rows + 2), counter_random(seed) {
+            for (size_t ty = first_tile_row; ty < end_tile_row; ty++) {
+                for (size_t tx = 0; tx < tiles_x; tx++) {
+                    tiles.push_back({ tx * width / tiles_x, (tx + 1) * width / tiles_x,
+                                      ty * height / tiles_y, (ty + 1) * height / tiles_y,
+                                      (tx % 2) + 2 * (ty % 2), ty * tiles_x + tx });
+                }
+            }
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+        size_t GetStep() const { return step; }
+        size_t GetFirstRow() const { return first_row; }
+        size_t GetNumRows() const { return num_rows; }
+
+        /**
+         * @brief Check whether this strip owns a global cell
+         * @param pos Global position index
+         * @return True if the cell's row belongs to this strip
+         */
+        bool Owns(size_t pos) const { return pos >= first_row * width && pos < (first_row + num_rows) * width; }
+
+        /**
+         * @brief Check if an owned cell holds an organism
+         *
+         * Cells of other strips always read as empty; the setup helpers only
+         * ask about the cell they are about to fill, so each worker can run
+         * the full population draw and keep its own placements.
+         * @param pos Global position index
+         * @return True if the cell is owned and not grass
+         */
+        bool IsOccupied(size_t pos) const { return Owns(pos) && species[Local(pos)] != EMPTY; }
+
+        /**
+         * @brief Place an organism if this strip owns the cell
+         * @param _species Species ID
+         * @param points Initial energy points
+         * @param pos Global position index
+         */
+        void AddOrgAt(int _species, double points, size_t pos) {
+            if (!Owns(pos)) return;
+            species[Local(pos)] = static_cast<uint8_t>(_species);
+            energy[Local(pos)] = points;
+        }
+
+        /**
+         * @brief Count organisms of each species in the owned rows
+         * @return Organisms per species, indexed by species ID
+         */
+        std::array<size_t, RegisteredSpecies::SIZE> CountSpecies() const {
+            std::array<size_t, RegisteredSpecies::SIZE> counts = {};
+            for (size_t i = width; i < (num_rows + 1) * width; i++) {
+                if (species[i] != EMPTY) counts[species[i]]++;
+            }
+            return counts;
+        }
+
+        /**
+         * @brief Copy the owned rows into a message for the coordinator
+         * @param out Set to the first row, row count, species bytes and energies
+         */
+        void PackRows(emp::vector<uint8_t> & out) const {
+            out.clear();
+            AppendValue(out, uint64_t(first_row));
+            AppendValue(out, uint64_t(num_rows));
+            const size_t num_cells = num_rows * width;
+            out.insert(out.end(), species.begin() + width, species.begin() + width + num_cells);
+            const uint8_t * energies = reinterpret_cast<const uint8_t *>(energy.data() + width);
+            out.insert(out.end(), energies, energies + num_cells * sizeof(double));
+        }
+
+        /**
+         * @brief Update the strip for one step in lockstep with the other workers
+         *
+         * Same phases as OrgWorld::UpdateEcologyTiled in COUNTER mode, with a
+         * halo exchange after each color of the process and move phases and
+         * after the death sweep.
+         * @return False if the transport failed
+         */
+        bool UpdateEcology() {
+            for (size_t color = 0; color < 4; color++) {
+                for (const StripTile & tile : tiles) {
+                    if (tile.color == color) ProcessTile(tile);
+                }
+                if (!Exchange()) return false;
+            }
+
+            for (size_t i = width; i < (num_rows + 1) * width; i++) {
+                if (species[i] != EMPTY && energy[i] <= 0) Clear(i);
+            }
+            if (!Exchange()) return false;
+
+            for (size_t color = 0; color < 4; color++) {
+                for (const StripTile & tile : tiles) {
+                    if (tile.color == color) MoveTile(tile);
+                }
+                if (!Exchange()) return false;
+            }
+            step++;
+            return true;
+        }
+
+        /**
+         * @brief Trade boundary rows and ghost changes with both neighbors
+         *
+         * Each worker sends its top row (and its changes to the upper ghost)
+         * up and its bottom row (and lower ghost changes) down, then applies
+         * what arrives: neighbors' changes land in its own boundary rows and
+         * their rows refresh its ghosts. With one or two workers the
+         * neighbors are the same process, which the direction tag sorts out.
+         * @return False if the transport failed
+         */
+        bool Exchange() {
+            for (Direction direction : { UP, DOWN }) {
+                CollectChanges(direction);
+                BuildHalo(direction);
+                if (!transport.Send(direction == UP ? up_rank : down_rank, message)) return false;
+            }
+            for (size_t from : { up_rank, down_rank }) {
+                if (!transport.Receive(from, message)) return false;
+                ApplyHalo();
+            }
+            // Keep this worker's own writes until the owner's copy reflects them
+            for (Direction direction : { UP, DOWN }) {
+                const size_t row = GhostRow(direction);
+                for (const GhostChange & change : changes[direction]) {
+                    species[row * width + change.x] = change.species;
+                    energy[row * width + change.x] = change.energy;
+                }
+            }
+            for (Direction direction : { UP, DOWN }) {
+                const size_t row = GhostRow(direction);
+                std::copy_n(species.begin() + row * width, width, ghost_species.begin() + direction * width);
+                std::copy_n(energy.begin() + row * width, width, ghost_energy.begin() + direction * width);
+            }
+            return true;
+        }
+
+    private:
+        /**
+         * @brief Convert an owned global index to a local one
+         * @param pos Global position index (must be owned)
+         * @return Local index
+         */
+        size_t Local(size_t pos) const { return pos - first_row * width + width; }
+
+        /**
+         * @brief Get the local row of a ghost
+         * @param direction UP for the row above the strip, DOWN for the row below
+         * @return Local row index
+         */
+        size_t GhostRow(Direction direction) const { return direction == UP ? 0 : num_rows + 1; }
+
+        /**
+         * @brief Empty a local cell
+         * @param local Local index
+         */
+        void Clear(size_t local) {
+            species[local] = EMPTY;
+            energy[local] = 0.0;
+        }
+
+        /**
+         * @brief Find the first empty neighbor of a local cell
+         * @param local Center (in an owned row)
+         * @return Empty neighbor's local index, or species.size() if none
+         */
+        size_t FindEmptyNeighbor(size_t local) const {
+            for (size_t n : stencil.Around(local)) {
+                if (species[n] == EMPTY) return n;
+            }
+            return species.size();
+        }
+
+
+        /**
+         * @brief Let every organism in a tile act in the tile's keyed order
+         * @param tile Tile to process
+         */
+        void ProcessTile(const StripTile & tile) {
+            cells.clear();
+            for (size_t y = tile.y0; y < tile.y1; y++) {
+                for (size_t x = tile.x0; x < tile.x1; x++) cells.push_back(y * width + x);
+            }
+            // Same slot range as OrgWorld::CounterShuffle gives this tile
+            counter_random.Shuffle(step, tile.index * width * height, cells);
+            for (size_t pos : cells) {
+                const size_t local = Local(pos);
+                RegisteredSpecies::Dispatch(species[local], [&](auto tag) { ProcessCell(tag, local, pos); });
+            }
+        }
+
+        /**
+         * @brief Apply the Mouse rules to the mouse in a cell
+         * @param local Local index of the mouse
+         */
+        void ProcessCell(SpeciesTag<Mouse>, size_t local, size_t) {
+            int grass_count = 0;
+            for (size_t n : stencil.Around(local)) grass_count += species[n] == EMPTY;
+
+            double points = energy[local];
+            if (grass_count > 0) points += Mouse::CalculateGrassBonus(grass_count);
+            points -= Mouse::METABOLISM_COST;
+
+            if (points >= Mouse::REPRODUCTION_THRESHOLD) {
+                const size_t child = FindEmptyNeighbor(local);
+                if (child != species.size()) {
+                    species[child] = Mouse::SPECIES_ID;
+                    energy[child] = Mouse::OFFSPRING_ENERGY;
+                    points -= Mouse::REPRODUCTION_COST;
+                }
+            }
+            energy[local] = points;
+        }
+
+        /**
+         * @brief Apply the Owl rules to the owl in a cell
+         * @param local Local index of the owl
+         * @param pos Global index of the owl (keys its prey draw)
+         */
+        void ProcessCell(SpeciesTag<Owl>, size_t local, size_t pos) {
+            NeighborList prey;
+            for (size_t n : stencil.Around(local)) {
+                if (species[n] == Mouse::SPECIES_ID) prey.Push(n);
+            }
+
+            // The owl moves onto its prey, but offspring are still placed around
+            // the cell it started the turn in (matching Owl::ProcessInWorld).
+            size_t owl_local = local;
+            double points = energy[local];
+            if (!prey.empty()) {
+                const size_t target = prey[counter_random.GetUInt(step, pos, RandomPurpose::PREY, prey.size())];
+                points += Owl::CalculateHuntReward(energy[target]);
+                Clear(local);
+                species[target] = Owl::SPECIES_ID;
+                owl_local = target;
+                points -= Owl::HUNTING_COST;
+            } else {
+                points -= Owl::STARVATION_COST;
+            }
+
+            if (points >= Owl::REPRODUCTION_THRESHOLD) {
+                const size_t child = FindEmptyNeighbor(local);
+                if (child != species.size()) {
+                    species[child] = Owl::SPECIES_ID;
+                    energy[child] = Owl::OFFSPRING_ENERGY;
+                    points -= Owl::REPRODUCTION_COST;
+                }
+            }
+            energy[owl_local] = points;
+        }
+
+        /**
+         * @brief Move organisms in a tile, scanning it in index order like OrgWorld::MoveTiles
+         * @param tile Tile to scan
+         */
+        void MoveTile(const StripTile & tile) {
+            for (size_t y = tile.y0; y < tile.y1; y++) {
+                for (size_t x = tile.x0; x < tile.x1; x++) {
+                    const size_t pos = y * width + x;
+                    const size_t local = Local(pos);
+                    if (species[local] == EMPTY) continue;
+                    if (!counter_random.P(step, pos, RandomPurpose::MOVE, OrgWorld::MOVE_PROBABILITY)) continue;
+                    const size_t offset = counter_random.GetUInt(step, pos, RandomPurpose::MOVE_TARGET, 9);
+                    const size_t target = stencil.InBlock(local, offset);
+                    if (species[target] != EMPTY) continue;
+                    species[target] = species[local];
+                    energy[target] = energy[local];
+                    Clear(local);
+                }
+            }
+        }
+
+        /**
+         * @brief Record which cells of a ghost row this worker changed since the last exchange
+         * @param direction Ghost to compare
+         */
+        void CollectChanges(Direction direction) {
+            emp::vector<GhostChange> & list = changes[direction];
+            list.clear();
+            const size_t row = GhostRow(direction) * width;
+            const size_t before = direction * width;
+            for (size_t x = 0; x < width; x++) {
+                if (species[row + x] != ghost_species[before + x] || energy[row + x] != ghost_energy[before + x]) {
+                    list.push_back({ static_cast<uint32_t>(x), species[row + x], energy[row + x] });
+                }
+            }
+        }
+
+        /**
+         * @brief Encode the halo message for one neighbor
+         * @param direction Which neighbor it goes to
+         */
+        void BuildHalo(Direction direction) {
+            message.clear();
+            AppendValue(message, uint32_t(direction));
+            AppendValue(message, uint32_t(changes[direction].size()));
+            const size_t row = (direction == UP ? 1 : num_rows) * width;
+            message.insert(message.end(), species.begin() + row, species.begin() + row + width);
+            const uint8_t * energies = reinterpret_cast<const uint8_t *>(energy.data() + row);
+            message.insert(message.end(), energies, energies + width * sizeof(double));
+            for (const GhostChange & change : changes[direction]) {
+                AppendValue(message, change.x);
+                AppendValue(message, change.species);
+                AppendValue(message, change.energy);
+            }
+        }
+
+        /**
+         * @brief Apply a received halo message
+         *
+         * A message travelling UP came from the strip below: its row becomes
+         * the lower ghost and its changes land in the bottom owned row. A
+         * message travelling DOWN mirrors that at the top.
+         */
+        void ApplyHalo() {
+            size_t at = 0;
+            const Direction direction = static_cast<Direction>(ReadValue<uint32_t>(message, at));
+            const uint32_t num_changes = ReadValue<uint32_t>(message, at);
+            const size_t ghost = (direction == UP ? num_rows + 1 : 0) * width;
+            const size_t owned = (direction == UP ? num_rows : 1) * width;
+
+            std::memcpy(&species[ghost], message.data() + at, width);
+            at += width;
+            std::memcpy(&energy[ghost], message.data() + at, width * sizeof(double));
+            at += width * sizeof(double);
+            for (uint32_t c = 0; c < num_changes; c++) {
+                const uint32_t x = ReadValue<uint32_t>(message, at);
+                species[owned + x] = ReadValue<uint8_t>(message, at);
+                energy[owned + x] = ReadValue<double>(message, at);
+            }
+        }
+};
+
+/**
+ * @brief Place a new organism in a strip if it owns the cell
+ * @param world Strip to place into
+ * @param species Species ID
+ * @param points Initial energy points
+ * @param pos Global position index
+ */
+inline void PlaceOrganism(StripWorld & world, emp::Random &, int species, double points, size_t pos) {
+    world.AddOrgAt(species, points, pos);
+}
+
+/**
+ * @brief Whole grid gathered from the workers at the end of a distributed run
+ */
+struct DistributedGrid {
+    emp::vector<uint8_t> species; ///< Species byte per cell (GridWorld::EMPTY for grass)
+    emp::vector<double> energy;   ///< Energy per cell
+};
+
+/**
+ * @brief Runs one world split into horizontal strips across forked worker processes
+ *
+ * The grid is tiled exactly as OrgWorld tiles it in COUNTER mode, and each
+ * worker owns a contiguous band of tile rows, so a run matches OrgWorld
+ * with SetRandomMode(COUNTER, seed) step for step whatever the worker
+ * count. Each worker allocates only its own strip after the fork, so on a
+ * NUMA machine its memory is local to wherever it runs. The calling
+ * process coordinates: it collects per-step species counts and, on
+ * request, the final grid.
+ */
+class DistributedRunner {
+    public:
+        static constexpr size_t MIN_TILE_SIDE = 4; ///< Same floor as OrgWorld's tiling
+
+        /// Called on the coordinator with each step's total species counts
+        using StepCallback = std::function<void(size_t step, const std::array<size_t, RegisteredSpecies::SIZE> & counts)>;
+
+    private:
+        EcologyConfig ecology;  ///< Grid size and starting population
+        size_t num_workers;     ///< Worker processes
+        size_t tiles_x = 0;     ///< Tiles across the grid
+        size_t tiles_y = 0;     ///< Tiles down the grid
+
+    public:
+        /**
+         * @brief Construct a runner
+         * @param _ecology Grid size and starting population
+         * @param _num_workers Worker processes (at most the number of tile rows)
+         * @param tile_side Target tile side, as OrgWorld::SetTileSide
+         */
+        DistributedRunner(const EcologyConfig & _ecology, size_t _num_workers, size_t tile_side = 64) :
+            ecology(_ecology), num_workers(_num_workers) {
+            // Same tiling as OrgWorld::BuildTiles
+            const size_t side = tile_side > MIN_TILE_SIDE ? tile_side : MIN_TILE_SIDE;
+            tiles_x = (ecology.width / side) & ~size_t(1);
+            tiles_y = (ecology.height / side) & ~size_t(1);
+            if (tiles_x < 2) tiles_x = 2;
+            if (tiles_y < 2) tiles_y = 2;
+        }
+
+        /**
+         * @brief Check that the grid can be tiled and split
+         * @param error Set to the problem if not
+         * @return True if Run can start
+         */
+        bool IsValid(std::string & error) const {
+            if (ecology.width / tiles_x < MIN_TILE_SIDE || ecology.height / tiles_y < MIN_TILE_SIDE) {
+                error = "grid is too small to tile";
+                return false;
+            }
+            if (num_workers < 1 || num_workers > tiles_y) {
+                error = "processes must be between 1 and " + std::to_string(tiles_y) + " (tile rows)";
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Populate and run one seed across the workers
+         * @param seed Seed for the population draw and the keyed generator
+         * @param steps UpdateEcology calls
+         * @param on_step Receives the counts after population (step 0) and after every step
+         * @param error Set to the problem on failure
+         * @param final_grid If not null, filled with the grid after the last step
+         * @return False if the run could not start or a worker failed
+         */
+        bool Run(int seed, size_t steps, const StepCallback & on_step, std::string & error,
+                 DistributedGrid * final_grid = nullptr) {
+            if (!IsValid(error)) return false;
+
+            const size_t coordinator = num_workers;
+            SharedMemoryTransport transport(num_workers + 1, ChannelCapacity());
+            if (!transport.IsOpen()) {
+                error = "cannot map shared memory";
+                return false;
+            }
+
+            emp::vector<pid_t> workers;
+            for (size_t rank = 0; rank < num_workers; rank++) {
+                const pid_t pid = fork();
+                if (pid == 0) {
+                    transport.SetRank(rank);
+                    const bool ok = RunWorker(transport, rank, seed, steps, final_grid != nullptr);
+                    if (!ok) transport.Abort();
+                    _exit(ok ? 0 : 1);
+                }
+                if (pid < 0) {
+                    error = "cannot start worker process";
+                    transport.Abort();
+                    break;
+                }
+                workers.push_back(pid);
+            }
+
+            // A worker that dies without aborting would leave the coordinator waiting forever
+            emp::vector<int> status(workers.size(), 0);
+            emp::vector<char> reaped(workers.size(), 0);
+            auto worker_failed = [&](size_t w) {
+                return reaped[w] && !(WIFEXITED(status[w]) && WEXITSTATUS(status[w]) == 0);
+            };
+            transport.SetRank(coordinator);
+            transport.SetIdleCheck([&]() {
+                for (size_t w = 0; w < workers.size(); w++) {
+                    if (!reaped[w] && waitpid(workers[w], &status[w], WNOHANG) == workers[w]) reaped[w] = 1;
+                    if (worker_failed(w)) return false;
+                }
+                return true;
+            });
+
+            bool ok = workers.size() == num_workers;
+            emp::vector<uint8_t> message;
+            for (size_t step = 0; ok && step <= steps; step++) {
+                std::array<size_t, RegisteredSpecies::SIZE> counts = {};
+                for (size_t rank = 0; ok && rank < num_workers; rank++) {
+                    ok = transport.Receive(rank, message);
+                    size_t at = 0;
+                    for (size_t s = 0; ok && s < counts.size(); s++) counts[s] += ReadValue<uint64_t>(message, at);
+                }
+                if (ok) on_step(step, counts);
+            }
+            if (ok && final_grid) ok = GatherGrid(transport, *final_grid);
+            if (!ok) transport.Abort();
+
+            for (size_t w = 0; w < workers.size(); w++) {
+                if (!reaped[w]) reaped[w] = waitpid(workers[w], &status[w], 0) == workers[w];
+                if (!reaped[w] || worker_failed(w)) ok = false;
+            }
+            if (!ok && error.empty()) error = "a worker process failed";
+            return ok;
+        }
+
+    private:
+        /**
+         * @brief Size each channel so a round of halo exchanges never blocks
+         *
+         * A worker can be at most one exchange ahead of a neighbor, and with
+         * two workers both of a neighbor's messages use the same channel, so
+         * a channel holds up to four halo messages.
+         * @return Ring size in bytes
+         */
+        size_t ChannelCapacity() const {
+            const size_t halo = 2 * sizeof(uint64_t) + ecology.width * (sizeof(uint8_t) + sizeof(double))
+                              + ecology.width * (sizeof(uint32_t) + sizeof(uint8_t) + sizeof(double));
+            return 4 * halo + 4096;
+        }
+
+        /**
+         * @brief Body of one worker process
+         * @param transport Transport with this worker's rank set
+         * @param rank Worker index
+         * @param seed Run seed
+         * @param steps UpdateEcology calls
+         * @param send_grid Whether to send the final rows to the coordinator
+         * @return False if the transport failed
+         */
+        bool RunWorker(Transport & transport, size_t rank, int seed, size_t steps, bool send_grid) const {
+            StripWorld strip(transport, ecology.width, ecology.height, tiles_x, tiles_y,
+                             rank * tiles_y / num_workers, (rank + 1) * tiles_y / num_workers,
+                             static_cast<uint32_t>(seed),
+                             (rank + num_workers - 1) % num_workers, (rank + 1) % num_workers);
+
+            // Every worker replays the whole population draw and keeps its own cells
+            emp::Random random(seed);
+            PopulateWithMice(strip, random, ecology);
+            PopulateWithOwls(strip, random, ecology);
+            if (!strip.Exchange()) return false;
+
+            emp::vector<uint8_t> report;
+            for (size_t step = 0; step <= steps; step++) {
+                if (step > 0 && !strip.UpdateEcology()) return false;
+                report.clear();
+                for (size_t count : strip.CountSpecies()) AppendValue(report, uint64_t(count));
+                if (!transport.Send(num_workers, report)) return false;
+            }
+
+            if (send_grid) {
+                strip.PackRows(report);
+                if (!transport.Send(num_workers, report)) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Assemble the final grid from every worker's rows
+         * @param transport Coordinator's transport
+         * @param grid Set to the whole grid
+         * @return False if the transport failed
+         */
+        bool GatherGrid(Transport & transport, DistributedGrid & grid) const {
+            const size_t width = ecology.width;
+            grid.species.assign(width * ecology.height, GridWorld::EMPTY);
+            grid.energy.assign(width * ecology.height, 0.0);
+            emp::vector<uint8_t> message;
+            for (size_t rank = 0; rank < num_workers; rank++) {
+                if (!transport.Receive(rank, message)) return false;
+                size_t at = 0;
+                const size_t first_row = ReadValue<uint64_t>(message, at);
+                const size_t num_cells = ReadValue<uint64_t>(message, at) * width;
+                std::memcpy(&grid.species[first_row * width], message.data() + at, num_cells);
+                at += num_cells;
+                std::memcpy(&grid.energy[first_row * width], message.data() + at, num_cells * sizeof(double));
+            }
+            return true;
+        }
+};
+
+#endif
@@ -0,0 +1,400 @@
+#ifndef ENSEMBLE_WORLD_H
+#define ENSEMBLE_WORLD_H
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+#include "emp/math/random_utils.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "Neighbors.h"
+#include "World.h"
+#include "Mouse.h"
+#include "Owl.h"
+#include "Species.h"
+
+/**
+ * @brief Many small replicate worlds advanced together, one lane per replicate
+ *
+ * Every replicate has the same grid size. Storage is interleaved by cell:
+ * the species bytes and energies of cell i in lanes 0..LANES-1 sit next to
+ * each other, so one cache line serves every lane and per-cell arithmetic
+ * runs across lanes as a short fixed-length loop the compiler turns into
+ * SIMD. Each lane owns its generator and draws from it in exactly the order
+ * GridWorld does, so lane l reproduces the GridWorld run of its seed step
+ * for step.
+ *
+ * A step runs GridWorld's phases in lockstep: every lane shuffles its own
+ * schedule, then position k of all lanes' schedules is processed together
+ * (gathered neighbor counts, then the Mouse energy update and reproduction
+ * test for all lanes at once, with owls and placements handled per lane),
+ * then the death sweep runs over the whole interleaved block and movement
+ * walks the cells once for all lanes. Lanes never read each other's cells,
+ * so processing them side by side does not change any lane's result.
+ * @tparam LANES Number of replicates stored together
+ */
+template <size_t LANES = 8>
+class EnsembleWorld {
+    static_assert(LANES >= 1 && LANES <= 32, "lane sets are kept in 32-bit masks");
+
+    public:
+        static constexpr uint8_t EMPTY = 0xFF; ///< Species byte of a grass (empty) cell (same as GridWorld)
+        static constexpr size_t NUM_LANES = LANES; ///< Replicates per ensemble
+
+    private:
+        size_t width;                                   ///< Grid width in cells
+        size_t height;                                  ///< Grid height in cells
+        size_t num_cells;                               ///< Cells per replicate
+        size_t num_lanes;                               ///< Lanes holding a replicate (the rest stay empty)
+        emp::vector<emp::Random> lane_random;           ///< Generator of each active lane
+        emp::vector<uint8_t> species;                   ///< Species byte of cell i, lane l at i * LANES + l
+        emp::vector<double> energy;                     ///< Energy of cell i, lane l at i * LANES + l
+        emp::vector<uint32_t> schedule;                 ///< Step order: k-th cell of lane l at k * LANES + l
+        NeighborStencil stencil;                        ///< Wrapped neighbor lookups for the grid
+        emp::vector<uint32_t> around;                   ///< The 8 neighbors of cell i (stencil order) at i * 8
+        std::array<size_t, LANES> num_orgs = {};        ///< Occupied cells per lane
+        size_t step = 0;                                ///< Number of UpdateEcology calls so far
+
+    public:
+        /**
+         * @brief Construct an ensemble with one lane per seed
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         * @param seeds Seed of each replicate's generator (at most LANES; unused lanes stay empty)
+         */
+        EnsembleWorld(size_t _width, size_t _height, const emp::vector<int> & seeds) :
+            width(_width), height(_height), num_cells(_width * _height),
+            num_lanes(seeds.size() < LANES ? seeds.size() : LANES),
+            species(_width * _height * LANES, EMPTY), energy(_width * _height * LANES, 0.0),
+            schedule(_width * _height * LANES), stencil(_width, _height), around(_width * _height * 8) {
+            // Replicate grids are small, so a flat table beats recomputing wrapped neighbors
+            for (size_t pos = 0; pos < num_cells; pos++) {
+                const NeighborList neighbors = stencil.Around(pos);
+                for (size_t j = 0; j < 8; j++) around[pos * 8 + j] = static_cast<uint32_t>(neighbors[j]);
+            }
+            lane_random.reserve(num_lanes);
+            for (size_t lane = 0; lane < num_lanes; lane++) lane_random.emplace_back(seeds[lane]);
+            // Empty lanes keep the identity order so the lockstep gathers stay in range
+            for (size_t k = 0; k < num_cells; k++) {
+                for (size_t lane = num_lanes; lane < LANES; lane++) schedule[k * LANES + lane] = static_cast<uint32_t>(k);
+            }
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+        size_t GetSize() const { return num_cells; }
+        size_t GetNumLanes() const { return num_lanes; }
+        size_t GetStep() const { return step; }
+
+        /**
+         * @brief Get a lane's generator, e.g. to populate it
+         * @param lane Lane index
+         * @return The lane's own generator
+         */
+        emp::Random & GetRandom(size_t lane) { return lane_random[lane]; }
+
+        /**
+         * @brief Get the number of organisms in one lane
+         * @param lane Lane index
+         * @return Occupied cells of that replicate
+         */
+        size_t GetNumOrgs(size_t lane) const { return num_orgs[lane]; }
+
+        /**
+         * @brief Check if a cell of one lane holds an organism
+         * @param lane Lane index
+         * @param pos Position index
+         * @return True if the cell is not grass
+         */
+        bool IsOccupied(size_t lane, size_t pos) const { return species[pos * LANES + lane] != EMPTY; }
+
+        /**
+         * @brief Get the species in a cell of one lane
+         * @param lane Lane index
+         * @param pos Position index
+         * @return Species ID, or EMPTY for grass
+         */
+        uint8_t GetSpecies(size_t lane, size_t pos) const { return species[pos * LANES + lane]; }
+
+        /**
+         * @brief Get the energy of the organism in a cell of one lane
+         * @param lane Lane index
+         * @param pos Position index
+         * @return Energy points (0 for grass)
+         */
+        double GetPoints(size_t lane, size_t pos) const { return energy[pos * LANES + lane]; }
+
+        /**
+         * @brief Place an organism in one lane, replacing anything already in the cell
+         * @param lane Lane index
+         * @param _species Species ID
+         * @param points Initial energy points
+         * @param pos Position index
+         */
+        void AddOrgAt(size_t lane, int _species, double points, size_t pos) {
+            const size_t cell = pos * LANES + lane;
+            if (species[cell] == EMPTY) num_orgs[lane]++;
+            species[cell] = static_cast<uint8_t>(_species);
+            energy[cell] = points;
+        }
+
+        /**
+         * @brief Remove the organism in a cell of one lane
+         * @param lane Lane index
+         * @param pos Position index
+         */
+        void RemoveOrganism(size_t lane, size_t pos) {
+            const size_t cell = pos * LANES + lane;
+            if (species[cell] != EMPTY) {
+                species[cell] = EMPTY;
+                energy[cell] = 0.0;
+                num_orgs[lane]--;
+            }
+        }
+
+        /**
+         * @brief Count organisms of each species in every lane with one pass
+         * @return Organisms per species (indexed by species ID) for each lane
+         */
+        std::array<std::array<size_t, RegisteredSpecies::SIZE>, LANES> CountSpecies() const {
+            std::array<std::array<uint32_t, LANES>, RegisteredSpecies::SIZE> tally = {};
+            for (size_t i = 0; i < num_cells; i++) {
+                const uint8_t * cell = &species[i * LANES];
+                RegisteredSpecies::ForEach([&](auto tag) {
+                    using S = typename decltype(tag)::type;
+                    for (size_t lane = 0; lane < LANES; lane++) tally[S::SPECIES_ID][lane] += cell[lane] == S::SPECIES_ID;
+                });
+            }
+
+            std::array<std::array<size_t, RegisteredSpecies::SIZE>, LANES> counts = {};
+            for (size_t lane = 0; lane < LANES; lane++) {
+                for (size_t s = 0; s < RegisteredSpecies::SIZE; s++) counts[lane][s] = tally[s][lane];
+            }
+            return counts;
+        }
+
+        /**
+         * @brief Update every lane for one simulation step
+         *
+         * Same phases and per-lane draw order as GridWorld::UpdateEcology.
+         */
+        void UpdateEcology() {
+            for (size_t lane = 0; lane < num_lanes; lane++) {
+                const emp::vector<size_t> order = emp::GetPermutation(lane_random[lane], num_cells);
+                for (size_t k = 0; k < num_cells; k++) schedule[k * LANES + lane] = static_cast<uint32_t>(order[k]);
+            }
+
+            for (size_t k = 0; k < num_cells; k++) ProcessScheduleSlot(&schedule[k * LANES]);
+
+            RemoveDeadOrganisms();
+            MoveOrganisms();
+            step++;
+        }
+
+    private:
+        /**
+         * @brief Check a cell of one lane through its interleaved index
+         * @param lane Lane index
+         * @param pos Position index
+         * @return True if the cell is grass
+         */
+        bool IsEmpty(size_t lane, size_t pos) const { return species[pos * LANES + lane] == EMPTY; }
+
+        /**
+         * @brief Find the first empty neighbor of a cell in one lane
+         * @param lane Lane index
+         * @param pos Center position
+         * @return Empty neighbor position, or GetSize() if none
+         */
+        size_t FindEmptyNeighbor(size_t lane, size_t pos) const {
+            for (size_t j = 0; j < 8; j++) {
+                if (IsEmpty(lane, around[pos * 8 + j])) return around[pos * 8 + j];
+            }
+            return num_cells;
+        }
+
+        /**
+         * @brief Let the organism at one schedule position act in every lane
+         *
+         * Mice, the bulk of most populations, have their energy update and
+         * reproduction test computed for all lanes in one branch-free pass;
+         * other species and offspring placement go lane by lane.
+         * @param at Cell each lane processes at this schedule position
+         */
+        void ProcessScheduleSlot(const uint32_t * at) {
+            std::array<uint8_t, LANES> kind;
+            std::array<double, LANES> points;
+            uint32_t mice = 0;   // Bit per lane whose cell holds a mouse
+            uint32_t others = 0; // Bit per lane whose cell holds another species
+            for (size_t lane = 0; lane < LANES; lane++) {
+                kind[lane] = species[at[lane] * LANES + lane];
+                points[lane] = energy[at[lane] * LANES + lane];
+                mice |= uint32_t(kind[lane] == Mouse::SPECIES_ID) << lane;
+                others |= uint32_t((kind[lane] != Mouse::SPECIES_ID) & (kind[lane] != EMPTY)) << lane;
+            }
+
+            // Walking set bits costs one unpredictable branch per slot rather than per lane
+            std::array<double, LANES> grass = {};
+            for (uint32_t bits = mice; bits; bits &= bits - 1) {
+                const size_t lane = __builtin_ctz(bits);
+                const uint32_t * neighbors = &around[at[lane] * 8];
+                int grass_count = 0;
+                for (size_t j = 0; j < 8; j++) grass_count += IsEmpty(lane, neighbors[j]);
+                grass[lane] = grass_count;
+            }
+
+            // Mouse energy update across all lanes; adding zero grass leaves the energy unchanged
+            std::array<double, LANES> fed;
+            uint32_t breed = 0;
+            for (size_t lane = 0; lane < LANES; lane++) {
+                fed[lane] = points[lane] + grass[lane] * Mouse::GRASS_BONUS_PER_CELL - Mouse::METABOLISM_COST;
+                breed |= uint32_t(fed[lane] >= Mouse::REPRODUCTION_THRESHOLD) << lane;
+            }
+            breed &= mice;
+
+            for (uint32_t bits = breed; bits; bits &= bits - 1) {
+                const size_t lane = __builtin_ctz(bits);
+                const size_t child_pos = FindEmptyNeighbor(lane, at[lane]);
+                if (child_pos != num_cells) {
+                    AddOrgAt(lane, Mouse::SPECIES_ID, Mouse::OFFSPRING_ENERGY, child_pos);
+                    fed[lane] -= Mouse::REPRODUCTION_COST;
+                }
+            }
+            for (uint32_t bits = mice; bits; bits &= bits - 1) {
+                const size_t lane = __builtin_ctz(bits);
+                energy[at[lane] * LANES + lane] = fed[lane];
+            }
+            for (uint32_t bits = others; bits; bits &= bits - 1) {
+                const size_t lane = __builtin_ctz(bits);
+                RegisteredSpecies::Dispatch(kind[lane], [&](auto tag) {
+                    using S = typename decltype(tag)::type;
+                    if constexpr (!std::is_same_v<S, Mouse>) ProcessCell(tag, lane, at[lane]);
+                });
+            }
+        }
+
+        /**
+         * @brief Apply the Owl rules to the owl in a cell of one lane
+         * @param lane Lane index
+         * @param pos Position of the owl
+         */
+        void ProcessCell(SpeciesTag<Owl>, size_t lane, size_t pos) {
+            NeighborList prey;
+            for (size_t j = 0; j < 8; j++) {
+                const size_t n = around[pos * 8 + j];
+                if (species[n * LANES + lane] == Mouse::SPECIES_ID) prey.Push(n);
+            }
+
+            // The owl moves onto its prey, but offspring are still placed around
+            // the cell it started the turn in (matching Owl::ProcessInWorld).
+            size_t owl_pos = pos;
+            double points = energy[pos * LANES + lane];
+            if (!prey.empty()) {
+                const size_t target = prey[lane_random[lane].GetUInt(prey.size())];
+                points += Owl::CalculateHuntReward(energy[target * LANES + lane]);
+                RemoveOrganism(lane, pos);
+                RemoveOrganism(lane, target);
+                AddOrgAt(lane, Owl::SPECIES_ID, points, target);
+                owl_pos = target;
+                points -= Owl::HUNTING_COST;
+            } else {
+                points -= Owl::STARVATION_COST;
+            }
+
+            if (points >= Owl::REPRODUCTION_THRESHOLD) {
+                const size_t child_pos = FindEmptyNeighbor(lane, pos);
+                if (child_pos != num_cells) {
+                    AddOrgAt(lane, Owl::SPECIES_ID, Owl::OFFSPRING_ENERGY, child_pos);
+                    points -= Owl::REPRODUCTION_COST;
+                }
+            }
+            energy[owl_pos * LANES + lane] = points;
+        }
+
+        /**
+         * @brief Remove dead organisms from every lane in one pass over the block
+         */
+        void RemoveDeadOrganisms() {
+            std::array<size_t, LANES> removed = {};
+            for (size_t i = 0; i < num_cells; i++) {
+                uint8_t * cell_species = &species[i * LANES];
+                double * cell_energy = &energy[i * LANES];
+                for (size_t lane = 0; lane < LANES; lane++) {
+                    const bool dead = (cell_species[lane] != EMPTY) & (cell_energy[lane] <= 0);
+                    cell_species[lane] = dead ? EMPTY : cell_species[lane];
+                    cell_energy[lane] = dead ? 0.0 : cell_energy[lane];
+                    removed[lane] += dead;
+                }
+            }
+            for (size_t lane = 0; lane < LANES; lane++) num_orgs[lane] -= removed[lane];
+        }
+
+        /**
+         * @brief Move organisms randomly based on movement probability
+         *
+         * Walks the cells once; each lane draws from its own generator in
+         * cell order, exactly as GridWorld::MoveOrganisms does.
+         */
+        void MoveOrganisms() {
+            for (size_t i = 0; i < num_cells; i++) {
+                const uint8_t * cell = &species[i * LANES];
+                uint32_t occupied = 0;
+                for (size_t lane = 0; lane < LANES; lane++) occupied |= uint32_t(cell[lane] != EMPTY) << lane;
+
+                for (uint32_t bits = occupied; bits; bits &= bits - 1) {
+                    const size_t lane = __builtin_ctz(bits);
+                    if (!lane_random[lane].P(OrgWorld::MOVE_PROBABILITY)) continue;
+                    const size_t from = i * LANES + lane;
+                    const size_t to = stencil.InBlock(i, lane_random[lane].GetUInt(9)) * LANES + lane;
+                    if (species[to] == EMPTY) {
+                        species[to] = species[from];
+                        energy[to] = energy[from];
+                        species[from] = EMPTY;
+                        energy[from] = 0.0;
+                    }
+                }
+            }
+        }
+};
+
+/**
+ * @brief One replicate of an EnsembleWorld, viewed as a single world
+ *
+ * Provides the cell accessors the setup helpers and TrajectoryRecorder use,
+ * so a lane is populated and recorded the same way as a GridWorld.
+ * @tparam LANES Lanes of the ensemble
+ */
+template <size_t LANES>
+class EnsembleLane {
+    private:
+        EnsembleWorld<LANES> &world; ///< Ensemble holding the replicate
+        size_t lane;                 ///< Lane of the replicate
+
+    public:
+        /**
+         * @brief Construct a view of one lane
+         * @param _world Ensemble holding the replicate
+         * @param _lane Lane index
+         */
+        EnsembleLane(EnsembleWorld<LANES> & _world, size_t _lane) : world(_world), lane(_lane) {}
+
+        size_t GetWidth() const { return world.GetWidth(); }
+        size_t GetHeight() const { return world.GetHeight(); }
+        size_t GetSize() const { return world.GetSize(); }
+        size_t GetStep() const { return world.GetStep(); }
+        size_t GetNumOrgs() const { return world.GetNumOrgs(lane); }
+        bool IsOccupied(size_t pos) const { return world.IsOccupied(lane, pos); }
+        uint8_t GetSpecies(size_t pos) const { return world.GetSpecies(lane, pos); }
+        double GetPoints(size_t pos) const { return world.GetPoints(lane, pos); }
+
+        /**
+         * @brief Place an organism in this lane
+         * @param species Species ID
+         * @param points Initial energy points
+         * @param pos Position index
+         */
+        void AddOrgAt(int species, double points, size_t pos) { world.AddOrgAt(lane, species, points, pos); }
+};
+
+#endif
@@ -0,0 +1,375 @@
+#ifndef GRID_WORLD_H
+#define GRID_WORLD_H
+
+#include "emp/math/Random.hpp"
+#include "emp/math/random_utils.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "BitGrid.h"
+#include "Neighbors.h"
+#include "World.h"
+#include "Mouse.h"
+#include "Owl.h"
+#include "Species.h"
+
+/**
+ * @brief Structure-of-arrays ecology engine
+ *
+ * Stores the toroidal grid as flat per-cell arrays (a species byte and an
+ * energy value) instead of heap-allocated organisms, and runs the Mouse/Owl
+ * rules in tight loops with no virtual calls or per-step allocation beyond
+ * the schedule. Random draws happen in the same order as OrgWorld, so both
+ * engines produce the same trajectory from the same seed and population.
+ */
+class GridWorld {
+    public:
+        static constexpr uint8_t EMPTY = 0xFF; ///< Species byte of a grass (empty) cell
+
+    private:
+        static constexpr size_t PREFETCH_DISTANCE = 16; ///< Schedule entries fetched ahead of processing
+        static constexpr size_t BLOCK_CELLS = 4096;     ///< Cells per block of the block schedule
+
+        emp::Random &random;            ///< Reference to random number generator
+        size_t width;                   ///< Grid width in cells
+        size_t height;                  ///< Grid height in cells
+        emp::vector<uint8_t> species;   ///< Species byte per cell (EMPTY for grass)
+        emp::vector<double> energy;     ///< Energy points per cell
+        NeighborStencil stencil;        ///< Wrapped neighbor lookups for the grid
+        size_t num_orgs = 0;            ///< Number of occupied cells
+        size_t step = 0;                ///< Number of UpdateEcology calls so far
+
+        bool snapshot_grazing = false;  ///< Read grass and prey counts from a start-of-step snapshot
+        bool block_schedule = false;    ///< Shuffle blocks and cells within blocks instead of the whole grid
+        emp::vector<uint32_t> cell_schedule; ///< Permutation schedule: cells in this step's order
+        emp::vector<uint32_t> block_order;  ///< Block schedule: blocks in this step's order
+        emp::vector<uint16_t> cell_order;   ///< Block schedule: offsets within the current block
+        BitPlane occupied_plane;        ///< Snapshot: cells holding any organism
+        BitPlane mouse_plane;           ///< Snapshot: cells holding a mouse
+        NeighborCounter counter;        ///< Whole-grid neighbor counting scratch
+        NeighborCounts occupied_counts; ///< Snapshot: occupied neighbors of each cell
+        NeighborCounts mouse_counts;    ///< Snapshot: mouse neighbors of each cell
+
+    public:
+        /**
+         * @brief Construct a new GridWorld
+         * @param _random Reference to random number generator
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells (NeighborStencil::Supports(_width, _height) must hold)
+         */
+        GridWorld(emp::Random &_random, size_t _width, size_t _height) :
+            random(_random), width(_width), height(_height),
+            species(_width * _height, EMPTY), energy(_width * _height, 0.0),
+            stencil(_width, _height) {
+            emp_assert(NeighborStencil::Supports(_width, _height), _width, _height);
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+        size_t GetSize() const { return species.size(); }
+        size_t GetNumOrgs() const { return num_orgs; }
+        size_t GetStep() const { return step; }
+        void SetStep(size_t _step) { step = _step; }
+
+        /**
+         * @brief Check if a cell holds an organism
+         * @param pos Position index
+         * @return True if the cell is not grass
+         */
+        bool IsOccupied(size_t pos) const { return species[pos] != EMPTY; }
+
+        /**
+         * @brief Get the species in a cell
+         * @param pos Position index
+         * @return Species ID, or EMPTY for grass
+         */
+        uint8_t GetSpecies(size_t pos) const { return species[pos]; }
+
+        /**
+         * @brief Get the energy of the organism in a cell
+         * @param pos Position index
+         * @return Energy points (0 for grass)
+         */
+        double GetPoints(size_t pos) const { return energy[pos]; }
+
+        /**
+         * @brief Place an organism, replacing anything already in the cell
+         * @param _species Species ID (Mouse::SPECIES_ID or Owl::SPECIES_ID)
+         * @param points Initial energy points
+         * @param pos Position index
+         */
+        void AddOrgAt(int _species, double points, size_t pos) {
+            if (!IsOccupied(pos)) num_orgs++;
+            species[pos] = static_cast<uint8_t>(_species);
+            energy[pos] = points;
+        }
+
+        /**
+         * @brief Remove the organism in a cell
+         * @param pos Position index
+         */
+        void RemoveOrganism(size_t pos) {
+            if (IsOccupied(pos)) {
+                species[pos] = EMPTY;
+                energy[pos] = 0.0;
+                num_orgs--;
+            }
+        }
+
+        /**
+         * @brief Choose where mice and owls get their neighborhood counts
+         *
+         * By default every organism looks at its neighbors at the moment it
+         * acts, exactly like OrgWorld. With snapshot grazing the mouse and
+         * occupancy layers are packed into bit-planes at the start of each
+         * step and counted for the whole grid at once with SIMD adds: mice
+         * graze on the grass around them as it was when the step began, and
+         * owls only hunt if a mouse was next to them then (the prey itself is
+         * still picked from the mice present when the owl acts). This is a
+         * different model from the reference, so trajectories diverge from
+         * OrgWorld; it trades per-organism neighbor scans for a few
+         * milliseconds per step on a 4096x4096 grid.
+         * @param enabled True to use start-of-step snapshots
+         */
+        void SetSnapshotGrazing(bool enabled) { snapshot_grazing = enabled; }
+
+        /**
+         * @brief Check whether snapshot grazing is on
+         * @return True if counts come from the start-of-step snapshot
+         */
+        bool GetSnapshotGrazing() const { return snapshot_grazing; }
+
+        /**
+         * @brief Choose how the action schedule is shuffled
+         *
+         * By default every step draws a permutation of the whole grid, like
+         * OrgWorld, so trajectories match it draw for draw. Building that
+         * permutation and then visiting cells in its order is most of a step
+         * on large grids: each swap and each visit is a cache miss. The block
+         * schedule instead splits the grid into runs of BLOCK_CELLS cells,
+         * visits the blocks in a random order and shuffles the cells of each
+         * block just before processing it, so shuffling and processing both
+         * stay within a block and its neighboring rows. Every cell still acts
+         * once per step in random order, but cells of the same block act
+         * consecutively, so this is a different schedule from the reference
+         * and trajectories diverge from OrgWorld.
+         * @param enabled True to shuffle block by block
+         */
+        void SetBlockSchedule(bool enabled) { block_schedule = enabled; }
+
+        /**
+         * @brief Check whether the block schedule is on
+         * @return True if cells are shuffled block by block
+         */
+        bool GetBlockSchedule() const { return block_schedule; }
+
+        /**
+         * @brief Update all organisms in the world for one simulation step
+         *
+         * Same phases as OrgWorld::UpdateEcology: process organisms in a
+         * random order, sweep out the dead, then move organisms randomly.
+         */
+        void UpdateEcology() {
+            if (snapshot_grazing) TakeNeighborSnapshot();
+
+            if (block_schedule) ProcessBlocks();
+            else ProcessPermutation();
+
+            RemoveDeadOrganisms();
+            MoveOrganisms();
+            step++;
+        }
+
+    private:
+        /**
+         * @brief Process every cell in the order of a whole-grid permutation
+         *
+         * Builds the permutation with emp::GetPermutation's inside-out draws,
+         * so the order matches OrgWorld's, but into a reused 32-bit buffer
+         * (grids hold fewer than 2^32 cells) instead of a new size_t vector.
+         */
+        void ProcessPermutation() {
+            const size_t num_cells = GetSize();
+            cell_schedule.resize(num_cells);
+            cell_schedule[0] = 0;
+            for (size_t k = 1; k < num_cells; k++) {
+                const size_t pos = random.GetUInt(k + 1);
+                cell_schedule[k] = cell_schedule[pos];
+                cell_schedule[pos] = static_cast<uint32_t>(k);
+            }
+
+            for (size_t k = 0; k < num_cells; k++) {
+                // The schedule visits cells in random order, so fetch ahead to hide cache misses.
+                if (k + PREFETCH_DISTANCE < num_cells) {
+                    const size_t ahead = cell_schedule[k + PREFETCH_DISTANCE];
+                    __builtin_prefetch(&species[ahead]);
+                    __builtin_prefetch(&species[ahead >= width ? ahead - width : ahead + num_cells - width]);
+                    __builtin_prefetch(&species[ahead + width < num_cells ? ahead + width : ahead + width - num_cells]);
+                    __builtin_prefetch(&energy[ahead]);
+                }
+                const size_t i = cell_schedule[k];
+                RegisteredSpecies::Dispatch(species[i], [&](auto tag) { ProcessCell(tag, i); });
+            }
+        }
+
+        /**
+         * @brief Process every cell block by block, in random order within each block
+         */
+        void ProcessBlocks() {
+            const size_t num_cells = GetSize();
+            const size_t num_blocks = (num_cells + BLOCK_CELLS - 1) / BLOCK_CELLS;
+            block_order.resize(num_blocks);
+            for (size_t b = 0; b < num_blocks; b++) block_order[b] = static_cast<uint32_t>(b);
+            emp::Shuffle(random, block_order);
+
+            cell_order.resize(BLOCK_CELLS);
+            for (uint32_t block : block_order) {
+                const size_t begin = block * BLOCK_CELLS;
+                const size_t count = std::min(BLOCK_CELLS, num_cells - begin);
+                // Shuffle from identity each time, so a short last block only holds its own offsets
+                for (size_t k = 0; k < count; k++) cell_order[k] = static_cast<uint16_t>(k);
+                for (size_t k = count - 1; k > 0; k--) std::swap(cell_order[k], cell_order[random.GetUInt(k + 1)]);
+                for (size_t k = 0; k < count; k++) {
+                    const size_t i = begin + cell_order[k];
+                    RegisteredSpecies::Dispatch(species[i], [&](auto tag) { ProcessCell(tag, i); });
+                }
+            }
+        }
+
+        /**
+         * @brief Count occupied and mouse neighbors of every cell in one pass
+         */
+        void TakeNeighborSnapshot() {
+            if (occupied_plane.GetWidth() != width || occupied_plane.GetHeight() != height) {
+                occupied_plane.Resize(width, height);
+                mouse_plane.Resize(width, height);
+            }
+            occupied_plane.Pack(species.data(), EMPTY, false);
+            mouse_plane.Pack(species.data(), Mouse::SPECIES_ID, true);
+            counter.Count(occupied_plane, occupied_counts);
+            counter.Count(mouse_plane, mouse_counts);
+        }
+
+        /**
+         * @brief Read a cell's entry in a snapshot count
+         * @param counts Snapshot counts
+         * @param pos Position index
+         * @return Neighbor count (0-8)
+         */
+        size_t SnapshotCount(const NeighborCounts & counts, size_t pos) const {
+            const size_t y = stencil.RowOf(pos);
+            return counts.Get(pos - y * width, y);
+        }
+
+        /**
+         * @brief Find the first empty neighbor of a cell
+         * @param pos Center position
+         * @return Empty neighbor position, or GetSize() if none
+         */
+        size_t FindEmptyNeighbor(size_t pos) const {
+            for (size_t n : stencil.Around(pos)) {
+                if (!IsOccupied(n)) return n;
+            }
+            return GetSize();
+        }
+
+        /**
+         * @brief Apply the Mouse rules to the mouse in a cell
+         * @param pos Position of the mouse
+         */
+        void ProcessCell(SpeciesTag<Mouse>, size_t pos) {
+            int grass_count = 0;
+            if (snapshot_grazing) {
+                grass_count = 8 - static_cast<int>(SnapshotCount(occupied_counts, pos));
+            } else {
+                for (size_t n : stencil.Around(pos)) {
+                    grass_count += !IsOccupied(n);
+                }
+            }
+
+            double points = energy[pos];
+            if (grass_count > 0) points += Mouse::CalculateGrassBonus(grass_count);
+            points -= Mouse::METABOLISM_COST;
+
+            if (points >= Mouse::REPRODUCTION_THRESHOLD) {
+                const size_t child_pos = FindEmptyNeighbor(pos);
+                if (child_pos != GetSize()) {
+                    AddOrgAt(Mouse::SPECIES_ID, Mouse::OFFSPRING_ENERGY, child_pos);
+                    points -= Mouse::REPRODUCTION_COST;
+                }
+            }
+            energy[pos] = points;
+        }
+
+        /**
+         * @brief Apply the Owl rules to the owl in a cell
+         * @param pos Position of the owl
+         */
+        void ProcessCell(SpeciesTag<Owl>, size_t pos) {
+            NeighborList prey;
+            if (!snapshot_grazing || SnapshotCount(mouse_counts, pos) > 0) {
+                for (size_t n : stencil.Around(pos)) {
+                    if (species[n] == Mouse::SPECIES_ID) prey.Push(n);
+                }
+            }
+
+            // The owl moves onto its prey, but offspring are still placed around
+            // the cell it started the turn in (matching Owl::ProcessInWorld).
+            size_t owl_pos = pos;
+            double points = energy[pos];
+            if (!prey.empty()) {
+                const size_t target = prey[random.GetUInt(prey.size())];
+                points += Owl::CalculateHuntReward(energy[target]);
+                RemoveOrganism(pos);
+                RemoveOrganism(target);
+                AddOrgAt(Owl::SPECIES_ID, points, target);
+                owl_pos = target;
+                points -= Owl::HUNTING_COST;
+            } else {
+                points -= Owl::STARVATION_COST;
+            }
+
+            if (points >= Owl::REPRODUCTION_THRESHOLD) {
+                const size_t child_pos = FindEmptyNeighbor(pos);
+                if (child_pos != GetSize()) {
+                    AddOrgAt(Owl::SPECIES_ID, Owl::OFFSPRING_ENERGY, child_pos);
+                    points -= Owl::REPRODUCTION_COST;
+                }
+            }
+            energy[owl_pos] = points;
+        }
+
+        /**
+         * @brief Remove dead organisms from the world
+         */
+        void RemoveDeadOrganisms() {
+            for (size_t i = 0; i < GetSize(); i++) {
+                if (IsOccupied(i) && energy[i] <= 0) {
+                    RemoveOrganism(i);
+                }
+            }
+        }
+
+        /**
+         * @brief Move organisms randomly based on movement probability
+         *
+         * Picks a target uniformly from the 3x3 block around each mover (the
+         * cell itself included), like emp::World::GetRandomNeighborPos on a grid.
+         */
+        void MoveOrganisms() {
+            for (size_t i = 0; i < GetSize(); i++) {
+                if (IsOccupied(i) && random.P(OrgWorld::MOVE_PROBABILITY)) {
+                    const size_t target = stencil.InBlock(i, random.GetUInt(9));
+                    if (!IsOccupied(target)) {
+                        species[target] = species[i];
+                        energy[target] = energy[i];
+                        species[i] = EMPTY;
+                        energy[i] = 0.0;
+                    }
+                }
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Build with -DAE_INSTRUMENT=1 to record per-step event counts and phase
+ * timings in OrgWorld. With the default of 0 every hook below expands to
+ * nothing, so the hot paths carry no extra loads, stores or branches.
+ */
+#ifndef AE_INSTRUMENT
+#define AE_INSTRUMENT 0
+#endif
+
+/**
+ * @brief Phases of UpdateEcology that get their own timer
+ */
+enum class EcologyPhase : int {
+    SCHEDULE = 0,   ///< Drawing the processing order
+    PROCESS,        ///< Organisms acting (hunting, grazing, reproducing)
+    REMOVE_DEAD,    ///< Sweeping out organisms with no energy left
+    MOVE,           ///< Random movement
+    NUM_PHASES
+};
+
+/**
+ * @brief Event counts and phase timings for one or more steps
+ */
+struct EcologyCounters {
+    static constexpr int NUM_PHASES = static_cast<int>(EcologyPhase::NUM_PHASES);
+
+    uint64_t hunts = 0;               ///< Owls that caught a mouse
+    uint64_t mouse_births = 0;        ///< Mouse offspring placed
+    uint64_t owl_births = 0;          ///< Owl offspring placed
+    uint64_t failed_placements = 0;   ///< Reproductions abandoned for lack of an empty cell
+    uint64_t starvation_deaths = 0;   ///< Organisms removed with no energy left
+    uint64_t moves_attempted = 0;     ///< Organisms that tried to move
+    uint64_t moves_succeeded = 0;     ///< Organisms that found an empty target
+    uint64_t phase_ns[NUM_PHASES] = {}; ///< Wall time per phase in nanoseconds
+
+    /**
+     * @brief Add another set of counters into this one
+     * @param other Counters to add
+     */
+    void Merge(const EcologyCounters & other) {
+        hunts += other.hunts;
+        mouse_births += other.mouse_births;
+        owl_births += other.owl_births;
+        failed_placements += other.failed_placements;
+        starvation_deaths += other.starvation_deaths;
+        moves_attempted += other.moves_attempted;
+        moves_succeeded += other.moves_succeeded;
+        for (int i = 0; i < NUM_PHASES; i++) phase_ns[i] += other.phase_ns[i];
+    }
+
+    /**
+     * @brief Zero every counter
+     */
+    void Reset() { *this = EcologyCounters(); }
+};
+
+/**
+ * @brief Adds the lifetime of a scope to one phase timer
+ */
+class ScopedPhaseTimer {
+    private:
+        uint64_t &target;                                  ///< Timer to add to
+        std::chrono::steady_clock::time_point start;       ///< When the scope began
+
+    public:
+        /**
+         * @brief Start timing
+         * @param counters Counters holding the timer
+         * @param phase Phase to charge
+         */
+        ScopedPhaseTimer(EcologyCounters & counters, EcologyPhase phase) :
+            target(counters.phase_ns[static_cast<int>(phase)]), start(std::chrono::steady_clock::now()) {}
+
+        ~ScopedPhaseTimer() {
+            target += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        }
+};
+
+#if AE_INSTRUMENT
+/// Increment a counter on the calling thread's counters for this world
+#define AE_COUNT(world, field) ((world).GetThreadCounters().field++)
+/// Time the rest of the enclosing scope as the given EcologyPhase
+#define AE_PHASE_TIMER(world, phase) ScopedPhaseTimer ae_phase_timer_((world).GetThreadCounters(), EcologyPhase::phase)
+#else
+#define AE_COUNT(world, field) ((void)0)
+#define AE_PHASE_TIMER(world, phase) ((void)0)
+#endif
+
+#endif
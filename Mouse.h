@@ -2,6 +2,7 @@
 #define MOUSE_H
 
 #include "Org.h"
+#include "OrgPool.h"
 #include "World.h"
 
 /**
@@ -11,22 +12,25 @@
  * and serve as prey for owls. They reproduce more frequently than owls
  * and require grass to gain energy.
  */
-class Mouse : public Organism {
-    private:
+class Mouse final : public Organism, public OrgPool<Mouse> {
+    public:
+        static constexpr int SPECIES_ID = 0;                   ///< Species identifier for mice
+        static constexpr const char * NAME = "mouse";          ///< Name used in output
+        static constexpr const char * COLOR = "gray";          ///< Color drawn by the animator
+        static constexpr uint32_t RGB = 0x808080;              ///< COLOR as 0xRRGGBB
         static constexpr double GRASS_BONUS_PER_CELL = 75.0;  ///< Energy gained per grass cell
         static constexpr double METABOLISM_COST = 50.0;       ///< Energy lost per turn
         static constexpr double REPRODUCTION_THRESHOLD = 800.0; ///< Energy needed to reproduce
         static constexpr double OFFSPRING_ENERGY = 300.0;      ///< Starting energy for offspring
         static constexpr double REPRODUCTION_COST = 700.0;     ///< Energy cost of reproduction
 
-    public:
         /**
          * @brief Construct a new Mouse
          * @param _random Pointer to random number generator
          * @param _points Initial energy points
          * @param _species Species identifier (should be 0 for mouse)
          */
-        Mouse(emp::Ptr<emp::Random> _random, double _points=0.0, int _species=0) :
+        Mouse(emp::Ptr<emp::Random> _random, double _points=0.0, int _species=SPECIES_ID) :
             Organism(_random, _points, _species) {}
 
         /**
@@ -49,8 +53,7 @@ class Mouse : public Organism {
             
             // Handle reproduction if conditions are met
             if (ShouldReproduce()) {
-                emp::Ptr<Organism> offspring = CreateOffspring();
-                if (PlaceOffspring(world, pos, offspring)) {
+                if (PlaceOffspring(world, pos)) {
                     // Deduct reproduction cost from parent
                     AddPoints(-GetReproductionCost());
                 }
@@ -99,35 +102,38 @@ class Mouse : public Organism {
             ProcessInWorld(world, pos);
         }
 
-    private:
         /**
          * @brief Calculate energy gained from nearby grass
          * @param grass_count Number of grass cells adjacent to mouse
          * @return Energy points gained from grass
          */
-        double CalculateGrassBonus(int grass_count) const {
+        static double CalculateGrassBonus(int grass_count) {
             return grass_count * GRASS_BONUS_PER_CELL;
         }
 
+    private:
+
         /**
          * @brief Attempt to place offspring in nearby empty cell
+         *
+         * The offspring is only created once an empty cell is found, so a
+         * failed attempt allocates nothing.
          * @param world Reference to the world
          * @param pos Current position of parent
-         * @param offspring Pointer to offspring to place
          * @return True if offspring was successfully placed
          */
-        bool PlaceOffspring(OrgWorld& world, size_t pos, emp::Ptr<Organism> offspring) {
-            // Try to place offspring in neighboring cells - use grid dimensions
-            std::vector<size_t> neighbors = world.GetNeighborPositions(pos, 20, 20);
-            
-            for (size_t neighbor_pos : neighbors) {
+        bool PlaceOffspring(OrgWorld& world, size_t pos) {
+            // Try to place offspring in neighboring cells
+            for (size_t neighbor_pos : world.GetNeighbors(pos)) {
                 if (!world.IsOccupied(neighbor_pos)) {
-                    world.AddOrgAt(offspring, neighbor_pos);
+                    world.AddOrgAt(CreateOffspring(), neighbor_pos);
+                    AE_COUNT(world, mouse_births);
                     return true;
                 }
             }
             
             // If no empty neighbors found, reproduction fails
+            AE_COUNT(world, failed_placements);
             return false;
         }
 };
@@ -0,0 +1,202 @@
+#ifndef NEIGHBORS_H
+#define NEIGHBORS_H
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Fixed-capacity list of up to 8 neighboring cell positions
+ *
+ * Lives on the stack, so building one never allocates. Supports range-for,
+ * indexing and size() like a small span.
+ */
+class NeighborList {
+    private:
+        std::array<size_t, 8> positions; ///< Stored positions
+        size_t count = 0;                ///< Number of valid entries
+
+    public:
+        NeighborList() = default;
+
+        /**
+         * @brief Append a position
+         * @param pos Position index (at most 8 may be added)
+         */
+        void Push(size_t pos) { positions[count++] = pos; }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        size_t operator[](size_t i) const { return positions[i]; }
+        const size_t * begin() const { return positions.data(); }
+        const size_t * end() const { return positions.data() + count; }
+};
+
+/**
+ * @brief Count the neighbors flagged in an 8-bit neighbor mask
+ *
+ * Bit k of a mask refers to the k-th neighbor in NeighborStencil order.
+ * @param mask Neighbor mask
+ * @return Number of set bits
+ */
+inline size_t MaskCount(uint8_t mask) {
+    return static_cast<size_t>(__builtin_popcount(mask));
+}
+
+/**
+ * @brief Find the neighbor index of the rank-th flagged neighbor
+ * @param mask Neighbor mask (must have more than rank bits set)
+ * @param rank Which flagged neighbor to find, counting from bit 0
+ * @return Stencil index in [0, 8)
+ */
+inline size_t MaskSelect(uint8_t mask, size_t rank) {
+    unsigned bits = mask;
+    for (; rank > 0; rank--) bits &= bits - 1;
+    return static_cast<size_t>(__builtin_ctz(bits));
+}
+
+/**
+ * @brief Wrapped 8-neighborhood lookups for a toroidal grid of any size
+ *
+ * Precomputes the wrapped previous/next column and row for every column and
+ * row, plus a multiply-shift reciprocal of the width, so finding the
+ * neighbors of a cell takes a multiply, a few table reads and no branches,
+ * modulo operations or allocation. Neighbors are always listed column by
+ * column (dx = -1, 0, 1), top to bottom within each column, the same order
+ * OrgWorld::GetNeighborPositions has always used.
+ */
+class NeighborStencil {
+    private:
+        size_t width = 0;                  ///< Grid width in cells
+        size_t height = 0;                 ///< Grid height in cells
+        uint64_t width_reciprocal = 0;     ///< ceil(2^64 / width) for fast division
+        emp::vector<uint32_t> col_prev;    ///< Wrapped column to the left of each column
+        emp::vector<uint32_t> col_next;    ///< Wrapped column to the right of each column
+        emp::vector<size_t> row_prev;      ///< Start index of the wrapped row above each row
+        emp::vector<size_t> row_next;      ///< Start index of the wrapped row below each row
+
+    public:
+        static constexpr size_t NUM_NEIGHBORS = 8; ///< Cells in a Moore neighborhood
+        static constexpr size_t MIN_SIDE = 2;      ///< Smallest width or height with no cell its own neighbor
+
+        NeighborStencil() = default;
+
+        /**
+         * @brief Construct a stencil for a grid
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         */
+        NeighborStencil(size_t _width, size_t _height) { Configure(_width, _height); }
+
+        /**
+         * @brief Check whether a stencil can be built for a grid
+         *
+         * A width of 1 would need a reciprocal of 2^64, and a side of 1 makes
+         * a cell its own neighbor, which no world handles.
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         * @return True if both sides are at least MIN_SIDE and the cell count fits in 32 bits
+         */
+        static bool Supports(size_t _width, size_t _height) {
+            return _width >= MIN_SIDE && _height >= MIN_SIDE && _width <= UINT32_MAX / _height;
+        }
+
+        /**
+         * @brief Rebuild the lookup tables for a grid
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells (Supports(_width, _height) must hold)
+         */
+        void Configure(size_t _width, size_t _height) {
+            emp_assert(Supports(_width, _height), _width, _height);
+            width = _width;
+            height = _height;
+            width_reciprocal = UINT64_C(0xFFFFFFFFFFFFFFFF) / width + 1;
+
+            col_prev.resize(width);
+            col_next.resize(width);
+            for (size_t x = 0; x < width; x++) {
+                col_prev[x] = static_cast<uint32_t>(x == 0 ? width - 1 : x - 1);
+                col_next[x] = static_cast<uint32_t>(x + 1 == width ? 0 : x + 1);
+            }
+
+            row_prev.resize(height);
+            row_next.resize(height);
+            for (size_t y = 0; y < height; y++) {
+                row_prev[y] = (y == 0 ? height - 1 : y - 1) * width;
+                row_next[y] = (y + 1 == height ? 0 : y + 1) * width;
+            }
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+
+        /**
+         * @brief Get the row of a cell without a division instruction
+         * @param pos Position index
+         * @return Row index
+         */
+        size_t RowOf(size_t pos) const {
+            return static_cast<size_t>((static_cast<unsigned __int128>(width_reciprocal) * pos) >> 64);
+        }
+
+        /**
+         * @brief Get all 8 wrapped neighbors of a cell
+         * @param pos Center position
+         * @return Neighbor positions in stencil order
+         */
+        NeighborList Around(size_t pos) const {
+            const size_t y = RowOf(pos);
+            const size_t row = y * width;
+            const size_t x = pos - row;
+            const size_t up = row_prev[y];
+            const size_t down = row_next[y];
+            const size_t left = col_prev[x];
+            const size_t right = col_next[x];
+
+            NeighborList out;
+            out.Push(up + left);
+            out.Push(row + left);
+            out.Push(down + left);
+            out.Push(up + x);
+            out.Push(down + x);
+            out.Push(up + right);
+            out.Push(row + right);
+            out.Push(down + right);
+            return out;
+        }
+
+        /**
+         * @brief Get the stencil index pointing back the other way
+         *
+         * If q is neighbor k of p, then p is neighbor Opposite(k) of q; the
+         * stencil order is symmetric, so this is just 7 - k.
+         * @param k Stencil index in [0, 8)
+         * @return Index of the opposite direction
+         */
+        static constexpr size_t Opposite(size_t k) { return NUM_NEIGHBORS - 1 - k; }
+
+        /**
+         * @brief Get a cell in the 3x3 block around a position
+         *
+         * Offsets follow emp::World::GetRandomNeighborPos on a grid: offset % 3
+         * picks the column (-1, 0, +1) and offset / 3 picks the row, so 4 is
+         * the center cell itself.
+         * @param pos Center position
+         * @param offset Block offset in [0, 9)
+         * @return Wrapped position
+         */
+        size_t InBlock(size_t pos, size_t offset) const {
+            const size_t y = RowOf(pos);
+            const size_t row = y * width;
+            const size_t x = pos - row;
+            const size_t dx = offset % 3;
+            const size_t dy = offset / 3;
+            const size_t nx = dx == 0 ? col_prev[x] : (dx == 1 ? x : col_next[x]);
+            const size_t nrow = dy == 0 ? row_prev[y] : (dy == 1 ? row : row_next[y]);
+            return nrow + nx;
+        }
+};
+
+#endif
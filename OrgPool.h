@@ -0,0 +1,149 @@
+#ifndef ORG_POOL_H
+#define ORG_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+/**
+ * @brief Slab pool that recycles storage for one organism type
+ *
+ * Inheriting from OrgPool<T> gives T class-level operator new/delete, so
+ * every `new T` and every delete (including emp::Ptr::Delete and emp::World
+ * clearing its population through an Organism pointer, thanks to the virtual
+ * destructor) goes through the pool. Freed slots go on a per-thread free
+ * list and are handed out again before any new slab is carved, so a long run
+ * holds steady at its peak population instead of growing. When a thread
+ * exits, its free slots move to a shared list, which a thread whose own list
+ * runs dry draws from a slab's worth at a time before carving a new slab, so
+ * worker threads that come and go do not strand storage. Slabs are kept for the lifetime of the process.
+ */
+template <typename T>
+class OrgPool {
+    private:
+        static constexpr size_t SLAB_OBJECTS = 1024; ///< Organisms carved from each slab
+
+        /**
+         * @brief Storage for one organism, or a link while it is free
+         */
+        union Slot {
+            Slot *next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        /**
+         * @brief A thread's free slots, handed to the shared list when the thread exits
+         */
+        struct FreeList {
+            Slot *head = nullptr; ///< First free slot
+
+            ~FreeList() {
+                if (!head) return;
+                Slot *tail = head;
+                while (tail->next) tail = tail->next;
+                std::lock_guard<std::mutex> lock(shared_mutex);
+                tail->next = shared_list;
+                shared_list = head;
+            }
+        };
+
+        /// Free slots owned by the current thread
+        static inline thread_local FreeList free_list;
+
+        /// Free slots left behind by threads that have exited
+        static inline Slot *shared_list = nullptr;
+
+        /// Guards shared_list
+        static inline std::mutex shared_mutex;
+
+        /// Number of slabs ever allocated for T
+        static inline std::atomic<size_t> slab_count{0};
+
+        /// Number of T currently alive
+        static inline std::atomic<long> live_count{0};
+
+    public:
+        /**
+         * @brief Allocate storage for a T from the pool
+         * @param size Requested size (derived types larger than T use the global heap)
+         * @return Uninitialized storage
+         */
+        static void * operator new(size_t size) {
+            if (size != sizeof(T)) return ::operator new(size);
+            FreeList & list = free_list;
+            if (!list.head) Refill(list);
+            Slot *slot = list.head;
+            list.head = slot->next;
+            live_count.fetch_add(1, std::memory_order_relaxed);
+            return slot;
+        }
+
+        /**
+         * @brief Return storage for a T to the current thread's free list
+         * @param ptr Storage from operator new
+         * @param size Size of the object being freed
+         */
+        static void operator delete(void *ptr, size_t size) {
+            if (!ptr) return;
+            if (size != sizeof(T)) {
+                ::operator delete(ptr);
+                return;
+            }
+            FreeList & list = free_list;
+            Slot *slot = static_cast<Slot *>(ptr);
+            slot->next = list.head;
+            list.head = slot;
+            live_count.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the number of slabs allocated for this type so far
+         * @return Slab count (each holds SLAB_OBJECTS organisms)
+         */
+        static size_t GetSlabCount() { return slab_count.load(); }
+
+        /**
+         * @brief Get the number of organisms of this type currently alive
+         * @return Live object count
+         */
+        static long GetLiveCount() { return live_count.load(); }
+
+    private:
+        /**
+         * @brief Give an empty free list up to a slab's worth of the shared slots, or a new slab
+         *
+         * Taking at most SLAB_OBJECTS slots leaves the rest for other threads
+         * refilling at the same time, so they do not carve slabs needlessly.
+         * @param list The current thread's (empty) free list
+         */
+        static void Refill(FreeList & list) {
+            {
+                std::lock_guard<std::mutex> lock(shared_mutex);
+                if (shared_list) {
+                    Slot *tail = shared_list;
+                    for (size_t i = 1; i < SLAB_OBJECTS && tail->next; i++) tail = tail->next;
+                    list.head = shared_list;
+                    shared_list = tail->next;
+                    tail->next = nullptr;
+                }
+            }
+            if (!list.head) AddSlab(list);
+        }
+
+        /**
+         * @brief Carve a new slab into free slots for the current thread
+         * @param list The current thread's free list
+         */
+        static void AddSlab(FreeList & list) {
+            Slot *slab = static_cast<Slot *>(::operator new(sizeof(Slot) * SLAB_OBJECTS));
+            for (size_t i = 0; i + 1 < SLAB_OBJECTS; i++) {
+                slab[i].next = &slab[i + 1];
+            }
+            slab[SLAB_OBJECTS - 1].next = list.head;
+            list.head = slab;
+            slab_count.fetch_add(1, std::memory_order_relaxed);
+        }
+};
+
+#endif
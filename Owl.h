@@ -2,7 +2,9 @@
 #define OWL_H
 
 #include "Org.h"
+#include "OrgPool.h"
 #include "World.h"
+#include "Mouse.h"
 
 /**
  * @brief Owl class representing carnivore predator species
@@ -11,8 +13,12 @@
  * and have higher reproduction thresholds than mice, maintaining
  * the predator-prey balance in the simulation.
  */
-class Owl : public Organism {
-    private:
+class Owl final : public Organism, public OrgPool<Owl> {
+    public:
+        static constexpr int SPECIES_ID = 1;                   ///< Species identifier for owls
+        static constexpr const char * NAME = "owl";            ///< Name used in output
+        static constexpr const char * COLOR = "brown";         ///< Color drawn by the animator
+        static constexpr uint32_t RGB = 0xA52A2A;              ///< COLOR as 0xRRGGBB
         static constexpr double HUNT_SUCCESS_RATE = 0.2;       ///< Fraction of mouse energy gained when hunting
         static constexpr double STARVATION_COST = 100.0;       ///< Energy lost when no prey found
         static constexpr double HUNTING_COST = 50.0;           ///< Energy cost of successful hunt
@@ -20,14 +26,13 @@ class Owl : public Organism {
         static constexpr double OFFSPRING_ENERGY = 400.0;      ///< Starting energy for offspring
         static constexpr double REPRODUCTION_COST = 2000.0;    ///< Energy cost of reproduction
 
-    public:
         /**
          * @brief Construct a new Owl
          * @param _random Pointer to random number generator
          * @param _points Initial energy points
          * @param _species Species identifier (should be 1 for owl)
          */
-        Owl(emp::Ptr<emp::Random> _random, double _points=0.0, int _species=1) :
+        Owl(emp::Ptr<emp::Random> _random, double _points=0.0, int _species=SPECIES_ID) :
             Organism(_random, _points, _species) {}
 
         /**
@@ -37,13 +42,13 @@ class Owl : public Organism {
          */
         void ProcessInWorld(OrgWorld& world, size_t pos) override {
             // Find nearby mice to hunt
-            std::vector<size_t> nearby_mice = FindNearbyMice(world, pos);
+            const uint8_t nearby_mice = world.GetMouseMask(pos);
             
             bool ate_mouse = false;
-            if (!nearby_mice.empty()) {
-                // Randomly select a mouse to hunt
-                size_t random_index = random->GetUInt(nearby_mice.size());
-                size_t target_mouse_pos = nearby_mice[random_index];
+            if (nearby_mice) {
+                // Randomly select a mouse to hunt, counting in neighbor order
+                size_t random_index = world.GetActionUInt(pos, RandomPurpose::PREY, MaskCount(nearby_mice));
+                size_t target_mouse_pos = world.GetNeighbors(pos)[MaskSelect(nearby_mice, random_index)];
                 ate_mouse = HuntMouse(world, pos, target_mouse_pos);
             }
             
@@ -56,8 +61,7 @@ class Owl : public Organism {
             
             // Handle reproduction if conditions are met
             if (ShouldReproduce()) {
-                emp::Ptr<Organism> offspring = CreateOffspring();
-                if (PlaceOffspring(world, pos, offspring)) {
+                if (PlaceOffspring(world, pos)) {
                     // Deduct reproduction cost from parent
                     AddPoints(-GetReproductionCost());
                 }
@@ -106,27 +110,36 @@ class Owl : public Organism {
             ProcessInWorld(world, pos);
         }
 
-    private:
+        /**
+         * @brief Calculate energy gained from hunting a mouse
+         * @param mouse_energy Energy of the hunted mouse
+         * @return Energy points gained by the owl
+         */
+        static double CalculateHuntReward(double mouse_energy) {
+            return mouse_energy * HUNT_SUCCESS_RATE;
+        }
+
         /**
          * @brief Find all mice in neighboring cells
          * @param world Reference to the world
          * @param pos Current position of the owl
-         * @return Vector of positions containing mice
+         * @return Positions containing mice, in neighbor order
          */
-        std::vector<size_t> FindNearbyMice(OrgWorld& world, size_t pos) {
-            std::vector<size_t> mouse_positions;
-            std::vector<size_t> neighbor_positions = world.GetNeighborPositions(pos, 20, 20);
+        static NeighborList FindNearbyMice(OrgWorld& world, size_t pos) {
+            NeighborList mouse_positions;
+            const NeighborList neighbors = world.GetNeighbors(pos);
+            const uint8_t mice = world.GetMouseMask(pos);
             
-            for (size_t neighbor_pos : neighbor_positions) {
-                if (world.IsOccupied(neighbor_pos) && 
-                    world.GetOrg(neighbor_pos).GetSpecies() == 0) {
-                    mouse_positions.push_back(neighbor_pos);
+            for (size_t k = 0; k < neighbors.size(); k++) {
+                if (mice & (1u << k)) {
+                    mouse_positions.Push(neighbors[k]);
                 }
             }
             
             return mouse_positions;
         }
 
+    private:
         /**
          * @brief Attempt to hunt a specific mouse
          * @param world Reference to the world
@@ -144,38 +157,32 @@ class Owl : public Organism {
             emp::Ptr<Organism> owl = world.ExtractOrganism(owl_pos);
             world.RemoveOrganism(mouse_pos);
             world.AddOrgAt(owl, mouse_pos);
+            AE_COUNT(world, hunts);
             
             return true;
         }
 
-        /**
-         * @brief Calculate energy gained from hunting a mouse
-         * @param mouse_energy Energy of the hunted mouse
-         * @return Energy points gained by the owl
-         */
-        double CalculateHuntReward(double mouse_energy) const {
-            return mouse_energy * HUNT_SUCCESS_RATE;
-        }
-
         /**
          * @brief Attempt to place offspring in nearby empty cell
+         *
+         * The offspring is only created once an empty cell is found, so a
+         * failed attempt allocates nothing.
          * @param world Reference to the world
          * @param pos Current position of parent
-         * @param offspring Pointer to offspring to place
          * @return True if offspring was successfully placed
          */
-        bool PlaceOffspring(OrgWorld& world, size_t pos, emp::Ptr<Organism> offspring) {
+        bool PlaceOffspring(OrgWorld& world, size_t pos) {
             // Try to place offspring in neighboring cells
-            std::vector<size_t> neighbors = world.GetNeighborPositions(pos, 20, 20);
-            
-            for (size_t neighbor_pos : neighbors) {
+            for (size_t neighbor_pos : world.GetNeighbors(pos)) {
                 if (!world.IsOccupied(neighbor_pos)) {
-                    world.AddOrgAt(offspring, neighbor_pos);
+                    world.AddOrgAt(CreateOffspring(), neighbor_pos);
+                    AE_COUNT(world, owl_births);
                     return true;
                 }
             }
             
             // If no empty neighbors found, reproduction fails
+            AE_COUNT(world, failed_placements);
             return false;
         }
 };
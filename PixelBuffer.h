@@ -0,0 +1,124 @@
+#ifndef PIXEL_BUFFER_H
+#define PIXEL_BUFFER_H
+
+#include "emp/base/vector.hpp"
+#include <array>
+#include <cstdint>
+
+#include "Setup.h"
+
+/**
+ * @brief One RGBA pixel per grid cell, repainted only where species changed
+ *
+ * Update compares every cell's species with the previous frame and writes
+ * palette colors for the cells that differ, tracking the band of rows that
+ * changed. A renderer then uploads that band as a single image instead of
+ * drawing one shape per cell.
+ */
+class SpeciesPixelBuffer {
+    private:
+        static constexpr uint8_t UNSEEN = 0xFE; ///< Species value no cell has, so the first Update repaints everything
+
+        size_t width = 0;                       ///< Grid width in cells
+        size_t height = 0;                      ///< Grid height in cells
+        emp::vector<uint32_t> pixels;           ///< RGBA pixels, row-major, byte order R, G, B, A
+        emp::vector<uint8_t> last_species;      ///< Species drawn in each cell last frame
+        std::array<uint32_t, 256> palette{};    ///< Pixel for each species byte
+        size_t dirty_begin = 0;                 ///< First changed row of the last Update
+        size_t dirty_end = 0;                   ///< One past the last changed row
+
+    public:
+        /**
+         * @brief Pack a color into a pixel
+         * @param r Red (0-255)
+         * @param g Green (0-255)
+         * @param b Blue (0-255)
+         * @param a Alpha (0-255)
+         * @return Pixel whose bytes in memory are r, g, b, a
+         */
+        static constexpr uint32_t RGBA(uint8_t r, uint8_t g, uint8_t b, uint8_t a=255) {
+            return uint32_t(r) | (uint32_t(g) << 8) | (uint32_t(b) << 16) | (uint32_t(a) << 24);
+        }
+
+        /**
+         * @brief Size the buffer for a grid and mark every cell dirty
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         */
+        void Resize(size_t _width, size_t _height) {
+            width = _width;
+            height = _height;
+            pixels.assign(width * height, 0);
+            last_species.assign(width * height, UNSEEN);
+        }
+
+        /**
+         * @brief Set the color drawn for a species
+         * @param species Species byte (GridWorld::EMPTY for grass)
+         * @param pixel Color from RGBA()
+         */
+        void SetColor(uint8_t species, uint32_t pixel) {
+            palette[species] = pixel;
+            last_species.assign(width * height, UNSEEN);
+        }
+
+        /**
+         * @brief Repaint the cells whose species changed since the last call
+         * @param world OrgWorld or GridWorld with the buffer's dimensions
+         * @return True if any cell changed
+         */
+        template <typename WORLD>
+        bool Update(const WORLD & world) {
+            return UpdateCells([&world](size_t pos) { return GetCellSpecies(world, pos); });
+        }
+
+        /**
+         * @brief Repaint from a species snapshot (e.g. one posted by a worker)
+         * @param species width * height species bytes, GridWorld::EMPTY for grass
+         * @return True if any cell changed
+         */
+        bool UpdateFromSpecies(const uint8_t * species) {
+            return UpdateCells([species](size_t pos) { return species[pos]; });
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+        size_t GetDirtyBegin() const { return dirty_begin; }
+        size_t GetDirtyEnd() const { return dirty_end; }
+
+        /**
+         * @brief Get the pixels of the whole grid
+         * @return Pointer to width * height RGBA pixels
+         */
+        const uint32_t * GetPixels() const { return pixels.data(); }
+
+    private:
+        /**
+         * @brief Compare every cell with the last frame and track dirty rows
+         * @param species_at Callable returning the species byte of a cell
+         * @return True if any cell changed
+         */
+        template <typename SPECIES_AT>
+        bool UpdateCells(SPECIES_AT species_at) {
+            dirty_begin = height;
+            dirty_end = 0;
+            for (size_t y = 0; y < height; y++) {
+                bool row_dirty = false;
+                for (size_t pos = y * width; pos < (y + 1) * width; pos++) {
+                    const uint8_t species = species_at(pos);
+                    if (species != last_species[pos]) {
+                        last_species[pos] = species;
+                        pixels[pos] = palette[species];
+                        row_dirty = true;
+                    }
+                }
+                if (row_dirty) {
+                    if (dirty_begin == height) dirty_begin = y;
+                    dirty_end = y + 1;
+                }
+            }
+            return dirty_end > dirty_begin;
+        }
+};
+
+#endif
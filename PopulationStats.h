@@ -0,0 +1,155 @@
+#ifndef POPULATION_STATS_H
+#define POPULATION_STATS_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Running per-species counts, energy totals and energy histograms
+ *
+ * OrgWorld updates these on every placement, removal and energy change, so
+ * reading them costs the same on any grid. Counts are signed so that the
+ * per-tile changes made by worker threads, which can be negative, use the
+ * same type and are folded in with Merge.
+ */
+class PopulationStats {
+    public:
+        static constexpr size_t MAX_SPECIES = 4;   ///< Species IDs tracked (0 to MAX_SPECIES - 1)
+        static constexpr size_t NUM_BINS = 32;     ///< Histogram bins per species
+        static constexpr double BIN_WIDTH = 100.0; ///< Energy range of one bin; the last bin also takes everything above
+
+        using Histogram = std::array<int64_t, NUM_BINS>; ///< Organisms per energy bin
+
+    private:
+        std::array<int64_t, MAX_SPECIES> counts = {};       ///< Organisms per species
+        std::array<double, MAX_SPECIES> energy = {};        ///< Summed energy per species
+        std::array<Histogram, MAX_SPECIES> histograms = {}; ///< Energy histogram per species
+
+    public:
+        /**
+         * @brief Get the histogram bin an energy value falls in
+         * @param points Energy points
+         * @return Bin index (energy at or below 0 goes in bin 0)
+         */
+        static size_t GetBin(double points) {
+            // Clamped without branches: energies cross bins unpredictably every turn
+            const double bin = std::min(std::max(points * (1.0 / BIN_WIDTH), 0.0), static_cast<double>(NUM_BINS - 1));
+            return static_cast<size_t>(bin);
+        }
+
+        /**
+         * @brief Check whether a species ID is tracked
+         * @param species Species ID
+         * @return True if it is below MAX_SPECIES
+         */
+        static bool Tracks(int species) { return species >= 0 && static_cast<size_t>(species) < MAX_SPECIES; }
+
+        /**
+         * @brief Count an organism that arrived
+         * @param species Its species
+         * @param points Its energy
+         */
+        void Add(int species, double points) {
+            if (!Tracks(species)) return;
+            counts[species]++;
+            energy[species] += points;
+            histograms[species][GetBin(points)]++;
+        }
+
+        /**
+         * @brief Stop counting an organism that left
+         * @param species Its species
+         * @param points Its energy
+         */
+        void Remove(int species, double points) {
+            if (!Tracks(species)) return;
+            counts[species]--;
+            energy[species] -= points;
+            histograms[species][GetBin(points)]--;
+        }
+
+        /**
+         * @brief Record a change in one organism's energy
+         * @param species Its species
+         * @param before Energy before the change
+         * @param after Energy after the change
+         */
+        void Change(int species, double before, double after) {
+            if (!Tracks(species)) return;
+            energy[species] += after - before;
+            histograms[species][GetBin(before)]--;
+            histograms[species][GetBin(after)]++;
+        }
+
+        /**
+         * @brief Add another set of statistics (or changes) to this one
+         * @param other Statistics to add
+         */
+        void Merge(const PopulationStats & other) {
+            for (size_t s = 0; s < MAX_SPECIES; s++) {
+                counts[s] += other.counts[s];
+                energy[s] += other.energy[s];
+                for (size_t bin = 0; bin < NUM_BINS; bin++) histograms[s][bin] += other.histograms[s][bin];
+            }
+        }
+
+        /**
+         * @brief Forget every organism
+         */
+        void Reset() { *this = PopulationStats(); }
+
+        /**
+         * @brief Get how many organisms of a species are alive
+         * @param species Species ID
+         * @return Organism count (0 for untracked species)
+         */
+        size_t GetCount(int species) const { return Tracks(species) ? static_cast<size_t>(counts[species]) : 0; }
+
+        /**
+         * @brief Get the summed energy of a species
+         * @param species Species ID
+         * @return Energy points (0 for untracked species)
+         */
+        double GetEnergy(int species) const { return Tracks(species) ? energy[species] : 0.0; }
+
+        /**
+         * @brief Get the mean energy of a species
+         * @param species Species ID
+         * @return Energy per organism (0 when there are none)
+         */
+        double GetMeanEnergy(int species) const {
+            const size_t count = GetCount(species);
+            return count > 0 ? GetEnergy(species) / count : 0.0;
+        }
+
+        /**
+         * @brief Get a species' energy histogram
+         * @param species Species ID (must be tracked)
+         * @return Organisms per BIN_WIDTH-wide energy bin
+         */
+        const Histogram & GetHistogram(int species) const { return histograms[species]; }
+
+        /**
+         * @brief Get how many tracked organisms are alive
+         * @return Organism count over all tracked species
+         */
+        size_t GetTotalCount() const {
+            int64_t total = 0;
+            for (int64_t count : counts) total += count;
+            return static_cast<size_t>(total);
+        }
+
+        /**
+         * @brief Get the summed energy of every tracked organism
+         * @return Energy points
+         */
+        double GetTotalEnergy() const {
+            double total = 0.0;
+            for (double points : energy) total += points;
+            return total;
+        }
+};
+
+#endif
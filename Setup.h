@@ -0,0 +1,225 @@
+#ifndef SETUP_H
+#define SETUP_H
+
+#include "emp/math/Random.hpp"
+#include <array>
+
+#include "World.h"
+#include "GridWorld.h"
+#include "ChunkedWorld.h"
+#include "EnsembleWorld.h"
+#include "Mouse.h"
+#include "Owl.h"
+#include "Species.h"
+
+/**
+ * @brief Parameters describing a world and its starting population
+ *
+ * Defaults match the configuration shown by AEAnimator.
+ */
+struct EcologyConfig {
+    size_t width = 20;                    ///< Grid width in cells
+    size_t height = 20;                   ///< Grid height in cells
+    int mouse_density_ratio = 4;          ///< One placement attempt per this many cells for mice (at least 1)
+    int owl_density_ratio = 40;           ///< One placement attempt per this many cells for owls (at least 1)
+    double initial_mouse_energy = 600.0;  ///< Starting energy of each mouse
+    double initial_owl_energy = 500.0;    ///< Starting energy of each owl
+};
+
+/**
+ * @brief Place a new organism in an OrgWorld
+ * @param world World to place into
+ * @param random Generator the organism keeps for its behavior
+ * @param species Species ID
+ * @param points Initial energy points
+ * @param pos Position index
+ */
+inline void PlaceOrganism(OrgWorld & world, emp::Random & random, int species, double points, size_t pos) {
+    RegisteredSpecies::Dispatch(species, [&](auto tag) {
+        using S = typename decltype(tag)::type;
+        world.AddOrgAt(emp::NewPtr<S>(&random, points), pos);
+    });
+}
+
+/**
+ * @brief Place a new organism in a GridWorld
+ * @param world World to place into
+ * @param species Species ID
+ * @param points Initial energy points
+ * @param pos Position index
+ */
+inline void PlaceOrganism(GridWorld & world, emp::Random &, int species, double points, size_t pos) {
+    world.AddOrgAt(species, points, pos);
+}
+
+/**
+ * @brief Place a new organism in a ChunkedWorld
+ * @param world World to place into
+ * @param species Species ID
+ * @param points Initial energy points
+ * @param pos Position index
+ */
+inline void PlaceOrganism(ChunkedWorld & world, emp::Random &, int species, double points, size_t pos) {
+    world.AddOrgAt(species, points, pos);
+}
+
+/**
+ * @brief Place a new organism in one lane of an EnsembleWorld
+ * @param world Lane to place into
+ * @param species Species ID
+ * @param points Initial energy points
+ * @param pos Position index
+ */
+template <size_t LANES>
+void PlaceOrganism(EnsembleLane<LANES> & world, emp::Random &, int species, double points, size_t pos) {
+    world.AddOrgAt(species, points, pos);
+}
+
+/**
+ * @brief Add mice to random positions in the world
+ *
+ * Makes one attempt per mouse_density_ratio cells and skips attempts that
+ * land on an occupied cell.
+ * @param world World to populate
+ * @param random Generator used for positions (and given to new organisms)
+ * @param config Population parameters
+ */
+template <typename WORLD>
+void PopulateWithMice(WORLD & world, emp::Random & random, const EcologyConfig & config) {
+    const size_t num_cells = config.width * config.height;
+    const size_t target_mice = num_cells / config.mouse_density_ratio;
+    for (size_t i = 0; i < target_mice; i++) {
+        size_t mouse_pos = random.GetUInt(num_cells);
+        if (!world.IsOccupied(mouse_pos)) {
+            PlaceOrganism(world, random, Mouse::SPECIES_ID, config.initial_mouse_energy, mouse_pos);
+        }
+    }
+}
+
+/**
+ * @brief Add owls to random positions in the world
+ * @param world World to populate
+ * @param random Generator used for positions (and given to new organisms)
+ * @param config Population parameters
+ */
+template <typename WORLD>
+void PopulateWithOwls(WORLD & world, emp::Random & random, const EcologyConfig & config) {
+    const size_t num_cells = config.width * config.height;
+    const size_t target_owls = num_cells / config.owl_density_ratio;
+    for (size_t i = 0; i < target_owls; i++) {
+        size_t owl_pos = random.GetUInt(num_cells);
+        if (!world.IsOccupied(owl_pos)) {
+            PlaceOrganism(world, random, Owl::SPECIES_ID, config.initial_owl_energy, owl_pos);
+        }
+    }
+}
+
+/**
+ * @brief Get the species byte of a cell in an OrgWorld
+ * @param world World to read
+ * @param pos Position index
+ * @return Species ID, or GridWorld::EMPTY for grass
+ */
+inline uint8_t GetCellSpecies(const OrgWorld & world, size_t pos) {
+    return world.IsOccupied(pos) ? static_cast<uint8_t>(world.GetOrg(pos).GetSpecies()) : GridWorld::EMPTY;
+}
+
+/**
+ * @brief Get the species byte of a cell in a GridWorld
+ * @param world World to read
+ * @param pos Position index
+ * @return Species ID, or GridWorld::EMPTY for grass
+ */
+inline uint8_t GetCellSpecies(const GridWorld & world, size_t pos) { return world.GetSpecies(pos); }
+
+/**
+ * @brief Get the species byte of a cell in a ChunkedWorld
+ * @param world World to read
+ * @param pos Position index
+ * @return Species ID, or GridWorld::EMPTY for grass
+ */
+inline uint8_t GetCellSpecies(const ChunkedWorld & world, size_t pos) { return world.GetSpecies(pos); }
+
+/**
+ * @brief Get the species byte of a cell in one lane of an EnsembleWorld
+ * @param world Lane to read
+ * @param pos Position index
+ * @return Species ID, or GridWorld::EMPTY for grass
+ */
+template <size_t LANES>
+uint8_t GetCellSpecies(const EnsembleLane<LANES> & world, size_t pos) { return world.GetSpecies(pos); }
+
+/**
+ * @brief Get the energy of the organism in a cell of an OrgWorld
+ * @param world World to read
+ * @param pos Position index
+ * @return Energy points (0 for grass)
+ */
+inline double GetCellPoints(const OrgWorld & world, size_t pos) {
+    return world.IsOccupied(pos) ? world.GetOrg(pos).GetPoints() : 0.0;
+}
+
+/**
+ * @brief Get the energy of the organism in a cell of a GridWorld
+ * @param world World to read
+ * @param pos Position index
+ * @return Energy points (0 for grass)
+ */
+inline double GetCellPoints(const GridWorld & world, size_t pos) { return world.GetPoints(pos); }
+
+/**
+ * @brief Get the energy of the organism in a cell of a ChunkedWorld
+ * @param world World to read
+ * @param pos Position index
+ * @return Energy points (0 for grass)
+ */
+inline double GetCellPoints(const ChunkedWorld & world, size_t pos) { return world.GetPoints(pos); }
+
+/**
+ * @brief Get the energy of the organism in a cell in one lane of an EnsembleWorld
+ * @param world Lane to read
+ * @param pos Position index
+ * @return Energy points (0 for grass)
+ */
+template <size_t LANES>
+double GetCellPoints(const EnsembleLane<LANES> & world, size_t pos) { return world.GetPoints(pos); }
+
+/**
+ * @brief Count organisms of each species from the world's running statistics
+ * @param world OrgWorld to read
+ * @return Organisms per species, indexed by species ID
+ */
+inline std::array<size_t, RegisteredSpecies::SIZE> CountSpecies(const OrgWorld & world) {
+    std::array<size_t, RegisteredSpecies::SIZE> counts = {};
+    for (size_t species = 0; species < counts.size(); species++) counts[species] = world.GetStats().GetCount(species);
+    return counts;
+}
+
+/**
+ * @brief Count organisms of each species with a full scan
+ * @param world GridWorld to scan
+ * @return Organisms per species, indexed by species ID
+ */
+inline std::array<size_t, RegisteredSpecies::SIZE> CountSpecies(const GridWorld & world) {
+    std::array<size_t, RegisteredSpecies::SIZE> counts = {};
+    for (size_t i = 0; i < world.GetSize(); i++) {
+        const uint8_t species = world.GetSpecies(i);
+        if (species != GridWorld::EMPTY) counts[species]++;
+    }
+    return counts;
+}
+
+/**
+ * @brief Count organisms of each species in the allocated chunks
+ * @param world ChunkedWorld to scan
+ * @return Organisms per species, indexed by species ID
+ */
+inline std::array<size_t, RegisteredSpecies::SIZE> CountSpecies(const ChunkedWorld & world) {
+    std::array<size_t, RegisteredSpecies::SIZE> counts = {};
+    world.ForEachOrganism([&counts](size_t, uint8_t species, double) {
+        counts[species]++;
+    });
+    return counts;
+}
+
+#endif
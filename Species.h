@@ -0,0 +1,224 @@
+#ifndef SPECIES_H
+#define SPECIES_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "World.h"
+#include "Mouse.h"
+#include "Owl.h"
+
+// Not included by World.h, Mouse.h or Owl.h on purpose: everything below
+// needs every species class complete, so this header comes after them.
+
+/**
+ * @brief Empty value naming a species type, for passing a type through a generic lambda
+ * @tparam SPECIES Species class
+ */
+template <typename SPECIES>
+struct SpeciesTag {
+    using type = SPECIES; ///< The species class
+};
+
+/**
+ * @brief Compile-time description of a species, read from its class constants
+ *
+ * Engines that do not store Organism objects (GridWorld, renderers, setup
+ * code) use these instead of comparing species IDs against literals.
+ * @tparam SPECIES Species class
+ */
+template <typename SPECIES>
+struct SpeciesTraits {
+    static constexpr int ID = SPECIES::SPECIES_ID;                                    ///< Species byte / Organism::GetSpecies() value
+    static constexpr const char * NAME = SPECIES::NAME;                               ///< Lower-case name for output
+    static constexpr const char * COLOR = SPECIES::COLOR;                             ///< CSS color used by the animator
+    static constexpr uint32_t RGB = SPECIES::RGB;                                     ///< Same color as 0xRRGGBB
+    static constexpr double REPRODUCTION_THRESHOLD = SPECIES::REPRODUCTION_THRESHOLD; ///< Energy needed to reproduce
+    static constexpr double REPRODUCTION_COST = SPECIES::REPRODUCTION_COST;           ///< Energy paid by the parent
+    static constexpr double OFFSPRING_ENERGY = SPECIES::OFFSPRING_ENERGY;             ///< Starting energy of offspring
+};
+
+/**
+ * @brief Type list of species with dispatch generated at compile time
+ *
+ * Dispatch expands to one comparison per species against constexpr IDs,
+ * which the compiler folds into a switch and inlines into the caller, so a
+ * world loop calls each species' code directly instead of through the
+ * Organism vtable. Adding a species means writing its class and appending
+ * it here; its SPECIES_ID must equal its position in the list.
+ * @tparam SPECIES Species classes, in ID order
+ */
+template <typename... SPECIES>
+struct SpeciesList {
+    static constexpr size_t SIZE = sizeof...(SPECIES); ///< Number of registered species
+
+    /**
+     * @brief Call fn with the tag of the species whose ID matches
+     * @param id Species ID
+     * @param fn Callable taking a SpeciesTag
+     * @return False if no registered species has this ID
+     */
+    template <typename FN>
+    static bool Dispatch(int id, FN && fn) {
+        return ((id == SpeciesTraits<SPECIES>::ID && (fn(SpeciesTag<SPECIES>{}), true)) || ...);
+    }
+
+    /**
+     * @brief Call fn once with the tag of every species, in ID order
+     * @param fn Callable taking a SpeciesTag
+     */
+    template <typename FN>
+    static void ForEach(FN && fn) {
+        (fn(SpeciesTag<SPECIES>{}), ...);
+    }
+
+    /**
+     * @brief Check that every species' ID is its position in the list
+     * @return True if IDs run 0, 1, 2, ... in list order
+     */
+    static constexpr bool IdsMatchPositions() {
+        int position = 0;
+        bool match = true;
+        ((match = match && SpeciesTraits<SPECIES>::ID == position++), ...);
+        return match;
+    }
+};
+
+/// Every species the engines know about
+using RegisteredSpecies = SpeciesList<Mouse, Owl>;
+
+static_assert(RegisteredSpecies::IdsMatchPositions(), "species IDs must match their registry positions");
+static_assert(RegisteredSpecies::SIZE <= PopulationStats::MAX_SPECIES, "PopulationStats must track every species");
+
+/**
+ * @brief Let the organism in a cell act, calling its species' code directly
+ *
+ * Mouse and Owl are final, so the qualified call and every call it makes on
+ * the organism itself bind statically and can be inlined.
+ * @param pos Position of organism to process
+ */
+inline void OrgWorld::ProcessOrganism(size_t pos) {
+    if (!IsOccupied(pos)) return;
+
+    Organism & org = *pop[pos];
+    // Species code changes its own energy directly, so the statistics take
+    // the turn's net change at the end; an owl that moved is the same object
+    const double before = org.GetPoints();
+    const bool known = RegisteredSpecies::Dispatch(org.GetSpecies(), [&](auto tag) {
+        using S = typename decltype(tag)::type;
+        static_cast<S &>(org).S::ProcessInWorld(*this, pos);
+    });
+    // Species registered elsewhere still work through the vtable
+    if (!known) org.ProcessInWorld(*this, pos);
+    StatsChanged(org, before);
+}
+
+inline void OrgWorld::ProposeHunt(size_t pos, const CounterRandom & keys) {
+    hunt_claims.target[pos] = CellClaims::NONE;
+    if (!IsOccupied(pos) || pop[pos]->GetSpecies() != Owl::SPECIES_ID) return;
+    const uint8_t nearby_mice = GetMouseMask(pos);
+    if (!nearby_mice) return;
+
+    // Same prey choice as Owl::ProcessInWorld, drawn from the keyed stream
+    const size_t random_index = keys.GetUInt(step, pos, RandomPurpose::PREY, MaskCount(nearby_mice));
+    hunt_claims.target[pos] = GetNeighbors(pos)[MaskSelect(nearby_mice, random_index)];
+    hunt_claims.priority[pos] = static_cast<uint32_t>(keys.GetBits(step, pos, RandomPurpose::HUNT_PRIORITY));
+}
+
+inline void OrgWorld::ResolveSynchronousCell(size_t pos, const CounterRandom & keys) {
+    birth_claims.target[pos] = CellClaims::NONE;
+    if (!IsOccupied(pos)) return;
+
+    const int species = pop[pos]->GetSpecies();
+    double points = pop[pos]->GetPoints();
+    if (species == Mouse::SPECIES_ID) {
+        // A caught mouse neither feeds nor breeds
+        if (hunt_claims.Winner(pos, stencil) != CellClaims::NONE) return;
+        const int grass_count = CheckNeighbors(pos)[2];
+        if (grass_count > 0) points += Mouse::CalculateGrassBonus(grass_count);
+        points -= Mouse::METABOLISM_COST;
+    } else if (species == Owl::SPECIES_ID) {
+        if (hunt_claims.Wins(pos, stencil)) {
+            points += Owl::CalculateHuntReward(pop[hunt_claims.target[pos]]->GetPoints());
+            points -= Owl::HUNTING_COST;
+        } else {
+            points -= Owl::STARVATION_COST;
+        }
+    }
+    next_points[pos] = points;
+
+    double threshold = 0.0;
+    const bool known = RegisteredSpecies::Dispatch(species, [&](auto tag) {
+        threshold = SpeciesTraits<typename decltype(tag)::type>::REPRODUCTION_THRESHOLD;
+    });
+    if (!known || points < threshold) return;
+
+    // Offspring go around the cell the parent started in, as in the asynchronous update
+    for (size_t neighbor_pos : GetNeighbors(pos)) {
+        if (!IsOccupied(neighbor_pos)) {
+            birth_claims.target[pos] = neighbor_pos;
+            birth_claims.priority[pos] = static_cast<uint32_t>(keys.GetBits(step, pos, RandomPurpose::BIRTH_PRIORITY));
+            return;
+        }
+    }
+    AE_COUNT(*this, failed_placements);
+}
+
+inline double OrgWorld::SynchronousPoints(size_t pos) const {
+    double cost = 0.0;
+    if (birth_claims.Wins(pos, stencil)) {
+        RegisteredSpecies::Dispatch(pop[pos]->GetSpecies(), [&](auto tag) {
+            cost = SpeciesTraits<typename decltype(tag)::type>::REPRODUCTION_COST;
+        });
+    }
+    return next_points[pos] - cost;
+}
+
+inline void OrgWorld::WriteSynchronousCell(size_t pos) {
+    emp::Ptr<Organism> org = pop[pos];
+    if (!org) {
+        const size_t parent = birth_claims.Winner(pos, stencil);
+        if (parent == CellClaims::NONE) return;
+        next_pop[pos] = pop[parent]->CreateOffspring();
+        ThreadStats().Add(next_pop[pos]->GetSpecies(), next_pop[pos]->GetPoints());
+        AdjustOrgCount(1);
+        if (pop[parent]->GetSpecies() == Owl::SPECIES_ID) AE_COUNT(*this, owl_births);
+        else AE_COUNT(*this, mouse_births);
+        return;
+    }
+
+    if (org->GetSpecies() == Mouse::SPECIES_ID) {
+        const size_t owl_pos = hunt_claims.Winner(pos, stencil);
+        if (owl_pos != CellClaims::NONE) {
+            // The owl takes the mouse's cell; the owl's own cell frees it if it starved anyway
+            AE_COUNT(*this, hunts);
+            org.Delete();
+            const double owl_points = SynchronousPoints(owl_pos);
+            if (owl_points > 0) {
+                next_pop[pos] = pop[owl_pos];
+                next_pop[pos]->SetPoints(owl_points);
+                ThreadStats().Add(Owl::SPECIES_ID, owl_points);
+                AdjustOrgCount(1);
+            }
+            return;
+        }
+    }
+
+    if (birth_claims.target[pos] != CellClaims::NONE && !birth_claims.Wins(pos, stencil)) {
+        AE_COUNT(*this, failed_placements);
+    }
+    const double points = SynchronousPoints(pos);
+    if (points <= 0) {
+        AE_COUNT(*this, starvation_deaths);
+        org.Delete();
+        return;
+    }
+    // An owl that caught its mouse is written into the mouse's cell instead
+    if (org->GetSpecies() == Owl::SPECIES_ID && hunt_claims.Wins(pos, stencil)) return;
+    org->SetPoints(points);
+    next_pop[pos] = org;
+    ThreadStats().Add(org->GetSpecies(), points);
+    AdjustOrgCount(1);
+}
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "emp/base/vector.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Small persistent pool of worker threads
+ *
+ * Runs indexed jobs across a fixed set of threads that stay alive between
+ * calls, so per-step parallel loops don't pay for thread creation. The
+ * calling thread takes part in every job.
+ */
+class ThreadPool {
+    private:
+        emp::vector<std::thread> workers;        ///< Helper threads (the caller is the extra one)
+        std::mutex mutex;                        ///< Guards job hand-off state
+        std::condition_variable start_cv;        ///< Signals workers that a job is ready
+        std::condition_variable done_cv;         ///< Signals the caller that workers finished
+        const std::function<void(size_t)> *job = nullptr; ///< Job body for the current call
+        size_t job_count = 0;                    ///< Number of indices in the current job
+        std::atomic<size_t> next_index{0};       ///< Next index to hand out
+        size_t generation = 0;                   ///< Incremented for every new job
+        size_t busy_workers = 0;                 ///< Workers still running the current job
+        bool stopping = false;                   ///< Set when the pool shuts down
+
+    public:
+        /**
+         * @brief Construct a pool
+         * @param num_threads Total threads to use, including the caller
+         */
+        explicit ThreadPool(size_t num_threads) {
+            for (size_t i = 1; i < num_threads; i++) {
+                workers.emplace_back([this]() { WorkerLoop(); });
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool & operator=(const ThreadPool &) = delete;
+
+        /**
+         * @brief Stop and join all worker threads
+         */
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            start_cv.notify_all();
+            for (std::thread & worker : workers) worker.join();
+        }
+
+        /**
+         * @brief Get the number of threads that run each job
+         * @return Worker count plus the calling thread
+         */
+        size_t GetNumThreads() const { return workers.size() + 1; }
+
+        /**
+         * @brief Run fn(i) for every i in [0, count) and wait for completion
+         * @param count Number of indices
+         * @param fn Job body; must be safe to call concurrently for different indices
+         */
+        void ParallelFor(size_t count, const std::function<void(size_t)> & fn) {
+            if (workers.empty() || count <= 1) {
+                for (size_t i = 0; i < count; i++) fn(i);
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = &fn;
+                job_count = count;
+                next_index = 0;
+                busy_workers = workers.size();
+                generation++;
+            }
+            start_cv.notify_all();
+
+            RunJob(fn, count);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done_cv.wait(lock, [this]() { return busy_workers == 0; });
+            job = nullptr;
+        }
+
+    private:
+        /**
+         * @brief Claim and run indices until the job is exhausted
+         * @param fn Job body
+         * @param count Number of indices in the job
+         */
+        void RunJob(const std::function<void(size_t)> & fn, size_t count) {
+            for (size_t i = next_index++; i < count; i = next_index++) {
+                fn(i);
+            }
+        }
+
+        /**
+         * @brief Main loop for helper threads
+         */
+        void WorkerLoop() {
+            size_t seen_generation = 0;
+            while (true) {
+                const std::function<void(size_t)> *current_job;
+                size_t current_count;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    start_cv.wait(lock, [&]() { return stopping || generation != seen_generation; });
+                    if (stopping) return;
+                    seen_generation = generation;
+                    current_job = job;
+                    current_count = job_count;
+                }
+
+                RunJob(*current_job, current_count);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    busy_workers--;
+                }
+                done_cv.notify_one();
+            }
+        }
+};
+
+#endif
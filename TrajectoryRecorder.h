@@ -0,0 +1,402 @@
+#ifndef TRAJECTORY_RECORDER_H
+#define TRAJECTORY_RECORDER_H
+
+#include "emp/base/vector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "BoundedQueue.h"
+#include "Setup.h"
+
+/**
+ * Trajectory file layout (native byte order):
+ *
+ *   header   "AETR", uint32 version, uint64 width, uint64 height,
+ *            uint32 record interval, uint32 keyframe interval
+ *   frames   uint8 kind (0 = keyframe, 1 = delta), uint64 step,
+ *            uint32 payload bytes, payload
+ *   index    uint64 count, then count pairs of (uint64 step, uint64 offset)
+ *            for every keyframe
+ *   footer   uint64 index offset, "AETI"
+ *
+ * A frame is the species byte of every cell (GridWorld::EMPTY for grass).
+ * Each payload is the frame XORed with a base: the previous frame for
+ * deltas, an all-grass grid for keyframes. Unchanged cells and grass then
+ * become zero bytes, and the payload stores alternating zero-run lengths
+ * and literal runs (see TrajectoryCodec). A file whose writer never closed
+ * it has no index; TrajectoryReader rebuilds one by scanning the frames.
+ */
+
+static constexpr uint32_t TRAJECTORY_VERSION = 1; ///< Current trajectory format version
+
+/**
+ * @brief Zero-run / literal-run coding of XOR deltas between frames
+ */
+class TrajectoryCodec {
+    public:
+        /**
+         * @brief Encode frame XOR base
+         * @param frame Current frame
+         * @param base Frame to diff against (same size)
+         * @param out Replaced with the payload
+         */
+        static void Encode(const emp::vector<uint8_t> & frame, const emp::vector<uint8_t> & base,
+                           emp::vector<uint8_t> & out) {
+            out.clear();
+            const size_t size = frame.size();
+            size_t pos = 0;
+            while (pos < size) {
+                const size_t zero_start = pos;
+                while (pos < size && frame[pos] == base[pos]) pos++;
+                const size_t literal_start = pos;
+                while (pos < size && frame[pos] != base[pos]) pos++;
+
+                PutVarint(out, literal_start - zero_start);
+                PutVarint(out, pos - literal_start);
+                for (size_t i = literal_start; i < pos; i++) out.push_back(frame[i] ^ base[i]);
+            }
+        }
+
+        /**
+         * @brief Apply a payload to a base frame in place
+         * @param payload Encoded bytes
+         * @param size Payload length
+         * @param frame Base frame on entry, decoded frame on return
+         * @return False if the payload is malformed
+         */
+        static bool Decode(const uint8_t * payload, size_t size, emp::vector<uint8_t> & frame) {
+            size_t in = 0;
+            size_t pos = 0;
+            while (in < size) {
+                uint64_t zeros = 0, literals = 0;
+                if (!GetVarint(payload, size, in, zeros) || !GetVarint(payload, size, in, literals)) return false;
+                pos += zeros;
+                if (pos + literals > frame.size() || in + literals > size) return false;
+                for (uint64_t i = 0; i < literals; i++) frame[pos++] ^= payload[in++];
+            }
+            return pos <= frame.size();
+        }
+
+    private:
+        /**
+         * @brief Append an unsigned LEB128 varint
+         * @param out Destination
+         * @param value Value to write
+         */
+        static void PutVarint(emp::vector<uint8_t> & out, uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        /**
+         * @brief Read an unsigned LEB128 varint
+         * @param data Input bytes
+         * @param size Input length
+         * @param in Read position, advanced past the varint
+         * @param value Set to the decoded value
+         * @return False if the input ends mid-varint
+         */
+        static bool GetVarint(const uint8_t * data, size_t size, size_t & in, uint64_t & value) {
+            value = 0;
+            for (int shift = 0; in < size && shift < 64; shift += 7) {
+                const uint8_t byte = data[in++];
+                value |= uint64_t(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) return true;
+            }
+            return false;
+        }
+};
+
+/**
+ * @brief Records the grid every N steps to a compressed trajectory file
+ *
+ * Capture copies the species layer on the simulation thread and queues it;
+ * a writer thread diffs, encodes and writes frames, so the simulation only
+ * waits if the writer falls a whole queue behind.
+ */
+class TrajectoryRecorder {
+    private:
+        /**
+         * @brief A captured grid waiting to be written
+         */
+        struct Frame {
+            uint64_t step;                 ///< Step the grid was captured at
+            emp::vector<uint8_t> species;  ///< Species byte per cell
+        };
+
+        size_t width;                      ///< Grid width in cells
+        size_t height;                     ///< Grid height in cells
+        size_t interval;                   ///< Record every this many steps
+        size_t keyframe_interval;          ///< Frames between keyframes
+        std::ofstream file;                ///< Output file
+        BoundedQueue<Frame> queue;         ///< Frames waiting for the writer
+        std::thread thread;                ///< Writer thread
+        std::atomic<bool> failed{false};   ///< Set if a write failed
+        bool closed = false;               ///< Set once Close has run
+
+    public:
+        /**
+         * @brief Open the file, write its header and start the writer thread
+         * @param path Output file
+         * @param _width Grid width in cells
+         * @param _height Grid height in cells
+         * @param _interval Record every this many steps (at least 1)
+         * @param _keyframe_interval Frames between keyframes (at least 1)
+         * @param queue_capacity Frames held in memory before Capture waits
+         */
+        TrajectoryRecorder(const std::string & path, size_t _width, size_t _height, size_t _interval=1,
+                           size_t _keyframe_interval=256, size_t queue_capacity=16) :
+            width(_width), height(_height), interval(_interval > 0 ? _interval : 1),
+            keyframe_interval(_keyframe_interval > 0 ? _keyframe_interval : 1),
+            file(path, std::ios::binary), queue(queue_capacity) {
+            const uint64_t dims[2] = { width, height };
+            const uint32_t version = TRAJECTORY_VERSION;
+            const uint32_t intervals[2] = { static_cast<uint32_t>(interval), static_cast<uint32_t>(keyframe_interval) };
+            file.write("AETR", 4);
+            file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+            file.write(reinterpret_cast<const char *>(dims), sizeof(dims));
+            file.write(reinterpret_cast<const char *>(intervals), sizeof(intervals));
+            thread = std::thread([this] { WriterLoop(); });
+        }
+
+        /**
+         * @brief Write remaining frames and the index
+         */
+        ~TrajectoryRecorder() { Close(); }
+
+        /**
+         * @brief Check that the file is open and every write so far succeeded
+         * @return True while the recording is healthy
+         */
+        bool IsOpen() const { return file.is_open() && !failed; }
+
+        /**
+         * @brief Queue the world's grid if its step is due for recording
+         * @param world OrgWorld or GridWorld with the recorder's dimensions
+         */
+        template <typename WORLD>
+        void Capture(const WORLD & world) {
+            if (world.GetStep() % interval != 0) return;
+            Frame frame;
+            frame.step = world.GetStep();
+            frame.species.resize(width * height);
+            for (size_t i = 0; i < frame.species.size(); i++) frame.species[i] = GetCellSpecies(world, i);
+            queue.Push(std::move(frame));
+        }
+
+        /**
+         * @brief Flush all queued frames, write the index and close the file
+         */
+        void Close() {
+            if (closed) return;
+            closed = true;
+            queue.Close();
+            if (thread.joinable()) thread.join();
+        }
+
+    private:
+        /**
+         * @brief Encode and write frames until the queue closes, then write the index
+         */
+        void WriterLoop() {
+            emp::vector<uint8_t> previous;
+            const emp::vector<uint8_t> blank(width * height, GridWorld::EMPTY);
+            emp::vector<uint8_t> payload;
+            emp::vector<std::pair<uint64_t, uint64_t>> keyframes;
+            size_t frames_written = 0;
+
+            Frame frame;
+            while (queue.Pop(frame)) {
+                const bool key = frames_written % keyframe_interval == 0;
+                TrajectoryCodec::Encode(frame.species, key ? blank : previous, payload);
+                if (key) keyframes.emplace_back(frame.step, static_cast<uint64_t>(file.tellp()));
+
+                const uint8_t kind = key ? 0 : 1;
+                const uint32_t size = static_cast<uint32_t>(payload.size());
+                file.write(reinterpret_cast<const char *>(&kind), 1);
+                file.write(reinterpret_cast<const char *>(&frame.step), sizeof(frame.step));
+                file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+                file.write(reinterpret_cast<const char *>(payload.data()), payload.size());
+                if (!file) failed = true;
+
+                previous.swap(frame.species);
+                frames_written++;
+            }
+
+            const uint64_t index_offset = static_cast<uint64_t>(file.tellp());
+            const uint64_t count = keyframes.size();
+            file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+            file.write(reinterpret_cast<const char *>(keyframes.data()), keyframes.size() * sizeof(keyframes[0]));
+            file.write(reinterpret_cast<const char *>(&index_offset), sizeof(index_offset));
+            file.write("AETI", 4);
+            file.flush();
+            if (!file) failed = true;
+        }
+};
+
+/**
+ * @brief Random access to a trajectory file
+ */
+class TrajectoryReader {
+    private:
+        static constexpr size_t HEADER_SIZE = 4 + 4 + 16 + 8; ///< Bytes before the first frame
+        static constexpr size_t FRAME_HEADER_SIZE = 1 + 8 + 4; ///< Kind, step and payload size
+
+        std::ifstream file;                                   ///< Input file
+        size_t width = 0;                                     ///< Grid width in cells
+        size_t height = 0;                                    ///< Grid height in cells
+        uint64_t frames_end = 0;                              ///< Offset where frames stop
+        emp::vector<std::pair<uint64_t, uint64_t>> keyframes; ///< (step, offset) of every keyframe
+
+    public:
+        /**
+         * @brief Open a trajectory and load (or rebuild) its keyframe index
+         * @param path Trajectory file
+         * @param error Set to a description of the problem on failure
+         * @return False if the file is not a readable trajectory
+         */
+        bool Open(const std::string & path, std::string & error) {
+            file.open(path, std::ios::binary);
+            char magic[4];
+            uint32_t version = 0;
+            uint64_t dims[2] = {0, 0};
+            uint32_t intervals[2];
+            file.read(magic, 4);
+            file.read(reinterpret_cast<char *>(&version), sizeof(version));
+            file.read(reinterpret_cast<char *>(dims), sizeof(dims));
+            file.read(reinterpret_cast<char *>(intervals), sizeof(intervals));
+            if (!file || std::memcmp(magic, "AETR", 4) != 0 || version != TRAJECTORY_VERSION) {
+                error = "not a version " + std::to_string(TRAJECTORY_VERSION) + " trajectory: " + path;
+                return false;
+            }
+            width = dims[0];
+            height = dims[1];
+            if (!ReadIndex()) ScanIndex();
+            return true;
+        }
+
+        size_t GetWidth() const { return width; }
+        size_t GetHeight() const { return height; }
+
+        /**
+         * @brief Get the steps and file offsets of all keyframes
+         * @return (step, offset) pairs in step order
+         */
+        const emp::vector<std::pair<uint64_t, uint64_t>> & GetKeyframes() const { return keyframes; }
+
+        /**
+         * @brief Decode the grid at a recorded step
+         *
+         * Jumps to the last keyframe at or before the step through the index
+         * and applies deltas from there, so the cost is bounded by the
+         * keyframe interval rather than the length of the run.
+         * @param step Step to decode
+         * @param grid Set to the species byte of every cell
+         * @return False if the step was not recorded
+         */
+        bool Seek(uint64_t step, emp::vector<uint8_t> & grid) {
+            auto it = std::upper_bound(keyframes.begin(), keyframes.end(), std::make_pair(step, UINT64_MAX));
+            if (it == keyframes.begin()) return false;
+            --it;
+
+            grid.assign(width * height, GridWorld::EMPTY);
+            uint64_t offset = it->second;
+            emp::vector<uint8_t> payload;
+            while (offset < frames_end) {
+                uint8_t kind;
+                uint64_t frame_step;
+                if (!ReadFrame(offset, kind, frame_step, payload)) return false;
+                if (frame_step > step) return false;
+                if (!TrajectoryCodec::Decode(payload.data(), payload.size(), grid)) return false;
+                if (frame_step == step) return true;
+                offset += FRAME_HEADER_SIZE + payload.size();
+            }
+            return false;
+        }
+
+    private:
+        /**
+         * @brief Read one frame
+         * @param offset File offset of the frame
+         * @param kind Set to 0 for a keyframe, 1 for a delta
+         * @param step Set to the frame's step
+         * @param payload Set to the frame's payload
+         * @return False if the frame is truncated
+         */
+        bool ReadFrame(uint64_t offset, uint8_t & kind, uint64_t & step, emp::vector<uint8_t> & payload) {
+            uint32_t size = 0;
+            file.clear();
+            file.seekg(static_cast<std::streamoff>(offset));
+            file.read(reinterpret_cast<char *>(&kind), 1);
+            file.read(reinterpret_cast<char *>(&step), sizeof(step));
+            file.read(reinterpret_cast<char *>(&size), sizeof(size));
+            if (!file || offset + FRAME_HEADER_SIZE + size > frames_end) return false;
+            payload.resize(size);
+            file.read(reinterpret_cast<char *>(payload.data()), size);
+            return static_cast<bool>(file);
+        }
+
+        /**
+         * @brief Load the index written when the recorder closed
+         * @return False if the file has no valid footer
+         */
+        bool ReadIndex() {
+            file.clear();
+            file.seekg(0, std::ios::end);
+            const uint64_t file_size = static_cast<uint64_t>(file.tellg());
+            if (file_size < HEADER_SIZE + 20) return false;
+
+            uint64_t index_offset = 0;
+            char magic[4];
+            file.seekg(static_cast<std::streamoff>(file_size - 12));
+            file.read(reinterpret_cast<char *>(&index_offset), sizeof(index_offset));
+            file.read(magic, 4);
+            if (!file || std::memcmp(magic, "AETI", 4) != 0 || index_offset < HEADER_SIZE
+                || index_offset + 8 > file_size - 12) {
+                return false;
+            }
+
+            uint64_t count = 0;
+            file.seekg(static_cast<std::streamoff>(index_offset));
+            file.read(reinterpret_cast<char *>(&count), sizeof(count));
+            if (!file || index_offset + 8 + count * 16 != file_size - 12) return false;
+            keyframes.resize(count);
+            file.read(reinterpret_cast<char *>(keyframes.data()), count * sizeof(keyframes[0]));
+            frames_end = index_offset;
+            return static_cast<bool>(file);
+        }
+
+        /**
+         * @brief Rebuild the keyframe index by walking every frame
+         *
+         * Used for files whose recorder never closed; a truncated final frame
+         * is ignored.
+         */
+        void ScanIndex() {
+            keyframes.clear();
+            file.clear();
+            file.seekg(0, std::ios::end);
+            frames_end = static_cast<uint64_t>(file.tellg());
+
+            uint64_t offset = HEADER_SIZE;
+            emp::vector<uint8_t> payload;
+            uint8_t kind;
+            uint64_t step;
+            while (offset < frames_end && ReadFrame(offset, kind, step, payload)) {
+                if (kind == 0) keyframes.emplace_back(step, offset);
+                offset += FRAME_HEADER_SIZE + payload.size();
+            }
+            frames_end = offset;
+        }
+};
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef WORK_STEALING_SCHEDULER_H
+#define WORK_STEALING_SCHEDULER_H
+
+#include "emp/base/vector.hpp"
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Runs a fixed set of independent tasks on all cores with work stealing
+ *
+ * Tasks are dealt round-robin into one deque per worker. Each worker takes
+ * from the back of its own deque and, once that is empty, steals from the
+ * front of the others, so replicates that finish early (or run short) free
+ * their core for the next task instead of leaving it idle.
+ */
+class WorkStealingScheduler {
+    private:
+        /**
+         * @brief One worker's queue of task IDs
+         */
+        struct WorkQueue {
+            std::mutex mutex;          ///< Guards tasks
+            std::deque<size_t> tasks;  ///< Pending task IDs
+        };
+
+        size_t num_threads;            ///< Number of worker threads
+
+    public:
+        /**
+         * @brief Construct a scheduler
+         * @param _num_threads Worker count (0 uses every hardware thread)
+         */
+        explicit WorkStealingScheduler(size_t _num_threads=0) : num_threads(_num_threads) {
+            if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+            if (num_threads == 0) num_threads = 1;
+        }
+
+        size_t GetNumThreads() const { return num_threads; }
+
+        /**
+         * @brief Run task(id, worker) for every id in [0, num_tasks) and wait
+         * @param num_tasks Number of tasks
+         * @param task Task body; receives the task ID and the worker index
+         */
+        void Run(size_t num_tasks, const std::function<void(size_t, size_t)> & task) {
+            const size_t workers = num_threads < num_tasks ? num_threads : (num_tasks ? num_tasks : 1);
+            emp::vector<WorkQueue> queues(workers);
+            for (size_t id = 0; id < num_tasks; id++) {
+                queues[id % workers].tasks.push_back(id);
+            }
+
+            auto worker_loop = [&](size_t self) {
+                size_t id;
+                while (TakeOwn(queues[self], id) || Steal(queues, self, id)) {
+                    task(id, self);
+                }
+            };
+
+            emp::vector<std::thread> threads;
+            for (size_t w = 1; w < workers; w++) threads.emplace_back(worker_loop, w);
+            worker_loop(0);
+            for (std::thread & thread : threads) thread.join();
+        }
+
+    private:
+        /**
+         * @brief Pop the newest task from a worker's own queue
+         * @param queue The worker's queue
+         * @param id Set to the task ID on success
+         * @return True if a task was taken
+         */
+        static bool TakeOwn(WorkQueue & queue, size_t & id) {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) return false;
+            id = queue.tasks.back();
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        /**
+         * @brief Take the oldest task from another worker's queue
+         * @param queues All worker queues
+         * @param self Index of the stealing worker
+         * @param id Set to the task ID on success
+         * @return True if a task was stolen; false once every queue is empty
+         */
+        static bool Steal(emp::vector<WorkQueue> & queues, size_t self, size_t & id) {
+            for (size_t offset = 1; offset < queues.size(); offset++) {
+                WorkQueue & victim = queues[(self + offset) % queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty()) {
+                    id = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+};
+
+#endif
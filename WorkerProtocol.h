@@ -0,0 +1,97 @@
+#ifndef WORKER_PROTOCOL_H
+#define WORKER_PROTOCOL_H
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "Setup.h"
+
+/**
+ * @brief Message from the animator asking the ecology worker to advance
+ *
+ * Sent as raw bytes through emscripten_call_worker. A restart request is
+ * followed by the animator's grid (see AppendWorkerGrid), and the worker
+ * rebuilds its world from it before stepping; the first request is always a
+ * restart. Other requests carry nothing else and continue the worker's world.
+ */
+struct WorkerRequest {
+    EcologyConfig config;   ///< World size
+    uint32_t seed = 0;      ///< Seed for the worker's generator (first request only)
+    uint32_t steps = 1;     ///< UpdateEcology calls to run before replying
+    uint32_t restart = 0;   ///< Nonzero if the animator's grid follows
+    uint64_t step = 0;      ///< Completed steps of the grid that follows (restart only)
+};
+
+/**
+ * @brief Start of the worker's reply, followed by the worker's grid
+ *
+ * The grid is in AppendWorkerGrid's layout, so the animator can both draw
+ * it and, when it stops using the worker, carry on from it.
+ */
+struct WorkerReplyHeader {
+    uint64_t step = 0;      ///< Completed steps in the worker's world
+    uint64_t num_orgs = 0;  ///< Organisms alive after the last step
+    std::array<uint64_t, PopulationStats::MAX_SPECIES> counts = {};    ///< Organisms per species ID
+    std::array<double, PopulationStats::MAX_SPECIES> mean_energy = {}; ///< Mean energy per species ID
+};
+
+/**
+ * @brief Get the size of a grid in AppendWorkerGrid's layout
+ * @param num_cells Cells in the world
+ * @return Size in bytes
+ */
+inline size_t WorkerGridSize(size_t num_cells) { return num_cells * (sizeof(double) + 1); }
+
+/**
+ * @brief Append a world's grid to a message
+ *
+ * The layout is one energy double per cell followed by one species byte
+ * per cell (GridWorld::EMPTY for grass), as in a checkpoint.
+ * @param world World to copy
+ * @param message Bytes to append to
+ */
+inline void AppendWorkerGrid(const OrgWorld & world, emp::vector<char> & message) {
+    const size_t start = message.size();
+    message.resize(start + WorkerGridSize(world.GetSize()));
+    char * energy = message.data() + start;
+    char * species = energy + world.GetSize() * sizeof(double);
+    for (size_t pos = 0; pos < world.GetSize(); pos++) {
+        const double points = GetCellPoints(world, pos);
+        std::memcpy(energy + pos * sizeof(double), &points, sizeof(points));
+        species[pos] = static_cast<char>(GetCellSpecies(world, pos));
+    }
+}
+
+/**
+ * @brief Get the species bytes of a grid in AppendWorkerGrid's layout
+ * @param grid Start of the grid
+ * @param num_cells Cells in the world
+ * @return One species byte per cell
+ */
+inline const uint8_t * GetWorkerGridSpecies(const char * grid, size_t num_cells) {
+    return reinterpret_cast<const uint8_t *>(grid + num_cells * sizeof(double));
+}
+
+/**
+ * @brief Replace a world's organisms with those of a grid in AppendWorkerGrid's layout
+ * @param world World to overwrite (must already have the grid's size)
+ * @param random Generator for the new organisms
+ * @param grid Start of the grid
+ * @param step Completed steps to give the world
+ */
+inline void LoadWorkerGrid(OrgWorld & world, emp::Random & random, const char * grid, uint64_t step) {
+    const uint8_t * species = GetWorkerGridSpecies(grid, world.GetSize());
+    for (size_t pos = 0; pos < world.GetSize(); pos++) {
+        world.RemoveOrganism(pos);
+        if (species[pos] == GridWorld::EMPTY) continue;
+        double points;
+        std::memcpy(&points, grid + pos * sizeof(double), sizeof(points));
+        PlaceOrganism(world, random, species[pos], points, pos);
+    }
+    world.SetStep(step);
+}
+
+#endif
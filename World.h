@@ -4,10 +4,17 @@
 #include "emp/Evolve/World.hpp"
 #include "emp/math/random_utils.hpp"
 #include "emp/math/Random.hpp"
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <vector>
 
+#include "CounterRandom.h"
+#include "Instrumentation.h"
+#include "Neighbors.h"
 #include "Org.h"
+#include "PopulationStats.h"
+#include "ThreadPool.h"
 
 /**
  * @brief World class managing the ecosystem simulation
@@ -17,18 +24,166 @@
  * and interact with each other and their environment.
  */
 class OrgWorld : public emp::World<Organism> {
+    public:
+        /**
+         * @brief How the serial update decides which cells act and in what order
+         */
+        enum class ScheduleMode {
+            FULL_PERMUTATION, ///< Shuffle every cell of the grid (the reference order)
+            ACTIVE_LIST       ///< Shuffle only a maintained list of occupied cells
+        };
+
+        /**
+         * @brief Where the update's random decisions come from
+         */
+        enum class RandomMode {
+            SHARED_STREAM, ///< Draw in call order from the world's generator (or a tile's stream)
+            COUNTER        ///< Draw from a CounterRandom keyed by (seed, step, cell, purpose)
+        };
+
+        /**
+         * @brief How the movement pass decides and applies moves
+         */
+        enum class MoveMode {
+            SEQUENTIAL, ///< Scan cells in index order and move each organism at once (the reference)
+            TWO_PHASE   ///< Propose every move from the same grid, then apply the conflict-free winners
+        };
+
+        /**
+         * @brief Whether organisms see each other's actions within a step
+         */
+        enum class UpdateMode {
+            ASYNCHRONOUS, ///< Act one at a time on the live grid (the reference)
+            SYNCHRONOUS   ///< Every organism reads the previous step's grid and writes into the next
+        };
+
     private:
+        /**
+         * @brief A rectangular block of cells updated as one unit in parallel mode
+         */
+        struct Tile {
+            size_t x0, x1;              ///< Column range [x0, x1)
+            size_t y0, y1;              ///< Row range [y0, y1)
+            size_t color;               ///< Phase in which this tile runs (0-3)
+            emp::vector<size_t> cells;  ///< Cell indices, reset and reshuffled each step
+            emp::Random random;         ///< Stream for actions inside this tile
+            long org_delta = 0;         ///< Organism count change not yet merged
+            PopulationStats stats_delta; ///< Statistics changes not yet merged
+            bool stats_changed = false; ///< Whether stats_delta holds anything
+            EcologyCounters counters;   ///< Events recorded by this tile's thread this step
+        };
+
+        /**
+         * @brief One claim per cell on a nearby cell, resolved by lowest priority
+         *
+         * Claims only ever target a cell in the claimant's 3x3 block, so every
+         * rival for a target sits in the block around it and each claim can
+         * be resolved by reading nine entries.
+         */
+        struct CellClaims {
+            static constexpr size_t NONE = static_cast<size_t>(-1); ///< target of a cell claiming nothing
+
+            emp::vector<size_t> target;     ///< Cell each cell claims, or NONE
+            emp::vector<uint32_t> priority; ///< Rank of each claim (lowest wins; ties go to the lower index)
+
+            /**
+             * @brief Size for a grid with no claims
+             * @param size Number of cells (0 when unused)
+             */
+            void Reset(size_t size) {
+                target.assign(size, NONE);
+                priority.assign(size, 0);
+            }
+
+            /**
+             * @brief Find which claim on a cell wins
+             * @param cell Claimed cell
+             * @param stencil Neighbor lookups for the grid
+             * @return Position of the winning claimant, or NONE if nobody claims it
+             */
+            size_t Winner(size_t cell, const NeighborStencil & stencil) const {
+                size_t winner = NONE;
+                for (size_t k = 0; k < 9; k++) {
+                    const size_t rival = stencil.InBlock(cell, k);
+                    if (target[rival] != cell) continue;
+                    if (winner == NONE || priority[rival] < priority[winner] ||
+                        (priority[rival] == priority[winner] && rival < winner)) {
+                        winner = rival;
+                    }
+                }
+                return winner;
+            }
+
+            /**
+             * @brief Check whether a cell's claim wins its target
+             * @param i Position of the claimant
+             * @param stencil Neighbor lookups for the grid
+             * @return False if it claims nothing or a rival wins
+             */
+            bool Wins(size_t i, const NeighborStencil & stencil) const {
+                return target[i] != NONE && Winner(target[i], stencil) == i;
+            }
+        };
+
+        static constexpr size_t NUM_COLORS = 4;   ///< 2x2 tile coloring
+        static constexpr size_t MIN_TILE_SIDE = 4; ///< Neighbor mask updates reach two cells outside a tile
+
+        /// Tile being processed by the current thread, if any
+        static inline thread_local Tile *active_tile = nullptr;
+
         emp::Random &random;              ///< Reference to random number generator
         emp::Ptr<emp::Random> random_ptr; ///< Owned pointer to random generator
-        
-        static constexpr double MOVE_PROBABILITY = 0.2; ///< Chance organism moves each turn
+        NeighborStencil stencil;          ///< Wrapped neighbor lookups for the grid
+        emp::vector<uint16_t> neighbor_masks; ///< Per cell: bit k set if neighbor k holds a mouse,
+                                              ///< bit 8 + k if it holds an owl
+
+        size_t num_threads = 1;           ///< Threads used by UpdateEcology
+        size_t tile_side = 64;            ///< Target tile side length in parallel mode
+        emp::Ptr<ThreadPool> thread_pool; ///< Workers for parallel mode (null when serial)
+        emp::vector<Tile> tiles;          ///< Tiling of the grid (empty when serial)
+
+        size_t step = 0;                  ///< Number of UpdateEcology calls so far
+
+        static constexpr size_t NOT_LISTED = static_cast<size_t>(-1); ///< occupied_slot of an empty cell
+
+        ScheduleMode schedule_mode = ScheduleMode::FULL_PERMUTATION; ///< Serial scheduling strategy
+        emp::vector<size_t> occupied_cells; ///< ACTIVE_LIST: every occupied cell, in the order the next shuffle starts from
+        emp::vector<size_t> occupied_slot;  ///< ACTIVE_LIST: index of each cell in occupied_cells, or NOT_LISTED
+        emp::vector<size_t> action_schedule; ///< Reused buffer for the step's schedule
+        emp::vector<size_t> sweep_cells;    ///< Reused buffer for the death and movement sweeps
+
+        RandomMode random_mode = RandomMode::SHARED_STREAM; ///< Source of the update's random decisions
+        CounterRandom counter_random;       ///< COUNTER: keyed generator for every decision
+
+        MoveMode move_mode = MoveMode::SEQUENTIAL; ///< How the movement pass runs
+        CounterRandom step_random;          ///< Keys for claim draws with SHARED_STREAM, reseeded every step
+        CellClaims move_claims;             ///< TWO_PHASE: cell each organism proposes to move to
+
+        UpdateMode update_mode;             ///< Fixed at construction
+        CellClaims hunt_claims;             ///< SYNCHRONOUS: mouse each owl tries to catch
+        CellClaims birth_claims;            ///< SYNCHRONOUS: empty cell each parent tries to place offspring in
+        emp::vector<double> next_points;    ///< SYNCHRONOUS: energy after feeding or hunting, before paying for offspring
+        emp::vector<emp::Ptr<Organism>> next_pop; ///< SYNCHRONOUS: grid being written (all null between steps)
+
+        EcologyCounters serial_counters;  ///< Events recorded outside any tile this step
+        EcologyCounters step_counters;    ///< Merged events of the last finished step
+        EcologyCounters total_counters;   ///< Merged events of every finished step
+
+        PopulationStats stats;            ///< Counts, energy and histograms of every organism in the world
 
     public:
+        static constexpr double MOVE_PROBABILITY = 0.2; ///< Chance organism moves each turn
+
         /**
          * @brief Construct a new OrgWorld
+         *
+         * See UpdateEcology for what SYNCHRONOUS changes; the rest of the
+         * interface behaves the same in both modes.
          * @param _random Reference to random number generator
+         * @param _update_mode Whether organisms act on the live grid or on the previous step's
          */
-        OrgWorld(emp::Random &_random) : emp::World<Organism>(_random), random(_random) {
+        OrgWorld(emp::Random &_random, UpdateMode _update_mode = UpdateMode::ASYNCHRONOUS)
+            : emp::World<Organism>(_random), random(_random), update_mode(_update_mode) {
             random_ptr.New(_random);
         }
 
@@ -36,34 +191,404 @@ class OrgWorld : public emp::World<Organism> {
          * @brief Destructor - cleanup resources
          */
         ~OrgWorld() {
+            if (thread_pool) thread_pool.Delete();
             random_ptr.Delete();
         }
 
+        /**
+         * @brief Set up the world as a toroidal grid
+         * @param width Grid width in cells
+         * @param height Grid height in cells (NeighborStencil::Supports(width, height) must hold)
+         * @param synchronous Whether emp should use synchronous generations
+         */
+        void SetPopStruct_Grid(size_t width, size_t height, bool synchronous=false) {
+            emp_assert(NeighborStencil::Supports(width, height), width, height);
+            emp::World<Organism>::SetPopStruct_Grid(width, height, synchronous);
+            stencil.Configure(width, height);
+            RebuildNeighborMasks();
+            BuildTiles();
+            RebuildOccupiedList();
+            ResetMoveProposals();
+            ResetSynchronousBuffers();
+            RecountStats();
+        }
+
+        /**
+         * @brief Get the number of completed steps
+         * @return UpdateEcology calls so far (or the value restored from a checkpoint)
+         */
+        size_t GetStep() const { return step; }
+
+        /**
+         * @brief Set the step counter, e.g. when restoring a checkpoint
+         * @param _step Completed steps
+         */
+        void SetStep(size_t _step) { step = _step; }
+
+        /**
+         * @brief Get the neighbor lookup for this world's grid
+         * @return Stencil sized to the world's width and height
+         */
+        const NeighborStencil & GetStencil() const { return stencil; }
+
+        /**
+         * @brief Get the 8 wrapped neighbors of a cell without allocating
+         * @param pos Center position
+         * @return Neighbor positions in stencil order
+         */
+        NeighborList GetNeighbors(size_t pos) const { return stencil.Around(pos); }
+
+        /**
+         * @brief Get which neighbors of a cell hold mice
+         *
+         * Kept up to date by AddOrgAt, ExtractOrganism and RemoveOrganism, so
+         * reading it costs one load instead of a scan of the neighborhood.
+         * @param pos Center position
+         * @return Mask with bit k set if neighbor k (stencil order) holds a mouse
+         */
+        uint8_t GetMouseMask(size_t pos) const { return static_cast<uint8_t>(neighbor_masks[pos]); }
+
+        /**
+         * @brief Get which neighbors of a cell hold owls
+         * @param pos Center position
+         * @return Mask with bit k set if neighbor k (stencil order) holds an owl
+         */
+        uint8_t GetOwlMask(size_t pos) const { return static_cast<uint8_t>(neighbor_masks[pos] >> 8); }
+
+        /**
+         * @brief Set the number of threads used by UpdateEcology
+         *
+         * With more than one thread the grid is split into tiles colored in a
+         * 2x2 checkerboard; tiles of one color are far enough apart that they
+         * never touch the same cells, so each color is processed concurrently
+         * and the colors run one after another. Every tile draws from its own
+         * random stream seeded from the world's generator, so results depend
+         * only on the seed and the tiling, not on thread timing.
+         * Call after SetPopStruct_Grid.
+         * @param _num_threads Number of threads (1 restores the serial update)
+         */
+        void SetThreads(size_t _num_threads) {
+            num_threads = _num_threads > 0 ? _num_threads : 1;
+            if (thread_pool) thread_pool.Delete();
+            thread_pool = nullptr;
+            if (num_threads > 1) thread_pool.New(num_threads);
+            BuildTiles();
+            RebuildOccupiedList();
+        }
+
+        /**
+         * @brief Get the number of threads used by UpdateEcology
+         * @return Thread count
+         */
+        size_t GetThreads() const { return num_threads; }
+
+        /**
+         * @brief Set the target tile side used in parallel mode
+         * @param side Tile side length in cells
+         */
+        void SetTileSide(size_t side) {
+            tile_side = side;
+            BuildTiles();
+            RebuildOccupiedList();
+        }
+
+        /**
+         * @brief Choose how the serial update schedules cells
+         *
+         * FULL_PERMUTATION draws a permutation of every cell each step and
+         * skips the empty ones; it is the reference order and matches
+         * GridWorld draw for draw. ACTIVE_LIST keeps a dense list of occupied
+         * cells up to date on every birth, death, hunt and move, and each step
+         * shuffles that list in place, so scheduling, the death sweep and
+         * movement cost time in proportion to the population rather than the
+         * grid. Organisms still act in a uniformly random order, but only those
+         * present when the step starts act, movers are visited once each in
+         * list order, and the random draws differ, so trajectories are
+         * statistically equivalent to the reference, not identical. The list
+         * order carries over between steps, so checkpoints save it (see
+         * GetOccupiedOrder).
+         * Parallel mode always uses its per-tile order.
+         * @param mode Scheduling strategy
+         */
+        void SetScheduleMode(ScheduleMode mode) {
+            schedule_mode = mode;
+            RebuildOccupiedList();
+        }
+
+        /**
+         * @brief Get the serial scheduling strategy
+         * @return Current schedule mode
+         */
+        ScheduleMode GetScheduleMode() const { return schedule_mode; }
+
+        /**
+         * @brief Get the active list in its current order
+         * @return Every occupied cell, in the order the next step shuffles from
+         *         (empty unless ACTIVE_LIST is in use on a serial update)
+         */
+        const emp::vector<size_t> & GetOccupiedOrder() const { return occupied_cells; }
+
+        /**
+         * @brief Put the active list in a saved order, as when restoring a checkpoint
+         *
+         * Does nothing unless the list is in use.
+         * @param order Every occupied cell exactly once
+         * @return False (leaving the list as it was) if order is not a permutation of the occupied cells
+         */
+        bool SetOccupiedOrder(const emp::vector<size_t> & order) {
+            if (!TracksOccupied()) return true;
+            if (order.size() != occupied_cells.size()) return false;
+            emp::vector<bool> seen(GetSize(), false);
+            for (size_t pos : order) {
+                if (pos >= GetSize() || !IsOccupied(pos) || seen[pos]) return false;
+                seen[pos] = true;
+            }
+            occupied_cells = order;
+            for (size_t k = 0; k < occupied_cells.size(); k++) occupied_slot[occupied_cells[k]] = k;
+            return true;
+        }
+
+        /**
+         * @brief Choose where the update's random decisions come from
+         *
+         * SHARED_STREAM is the reference behavior. With COUNTER, the schedule,
+         * prey choice and movement draw from a CounterRandom keyed by the step,
+         * the cell and the decision, and the world's generator is not touched
+         * by UpdateEcology at all. The grid is then always split into tiles
+         * (run one after another on a single thread), so a run depends only on
+         * the seed, the grid and the tile side: any thread count, including
+         * one, gives the same trajectory. Grids too small to tile use the
+         * serial phases with the same keyed draws. Trajectories differ from
+         * SHARED_STREAM.
+         * @param mode Random source
+         * @param seed Seed for COUNTER mode (ignored otherwise)
+         */
+        void SetRandomMode(RandomMode mode, uint32_t seed=0) {
+            random_mode = mode;
+            counter_random.SetSeed(seed);
+            BuildTiles();
+            RebuildOccupiedList();
+        }
+
+        /**
+         * @brief Get where the update's random decisions come from
+         * @return Current random mode
+         */
+        RandomMode GetRandomMode() const { return random_mode; }
+
+        /**
+         * @brief Choose how organisms move at the end of each step
+         *
+         * SEQUENTIAL is the reference: cells are scanned in index order and
+         * each organism moves as soon as it is reached, so one moved to a
+         * higher index can be reached and moved again. TWO_PHASE first lets
+         * every organism propose a target from the grid left by the death
+         * sweep, with keyed draws per cell (in parallel over the tiles when
+         * there are threads). A proposal to an empty cell wins unless a rival
+         * for the same cell has a lower priority draw, and all winners then
+         * move at once. Every organism moves at most once and the outcome
+         * does not depend on scan order, tiling or thread count, but
+         * trajectories differ from SEQUENTIAL. With SHARED_STREAM the keys are
+         * seeded from one draw of the world's generator per step.
+         * @param mode Movement strategy
+         */
+        void SetMoveMode(MoveMode mode) {
+            move_mode = mode;
+            ResetMoveProposals();
+        }
+
+        /**
+         * @brief Get how organisms move at the end of each step
+         * @return Current move mode
+         */
+        MoveMode GetMoveMode() const { return move_mode; }
+
+        /**
+         * @brief Get whether organisms act on the live grid or on the previous step's
+         * @return Update mode chosen at construction
+         */
+        UpdateMode GetUpdateMode() const { return update_mode; }
+
+        /**
+         * @brief Draw an integer for a decision an organism makes while acting
+         *
+         * Organisms call this instead of drawing from a generator directly, so
+         * the same code works in both random modes.
+         * @param pos Position the decision is about (the acting organism's cell)
+         * @param purpose What the draw is for
+         * @param n Number of outcomes (at least 1)
+         * @return Value in [0, n)
+         */
+        size_t GetActionUInt(size_t pos, RandomPurpose purpose, size_t n) {
+            if (random_mode == RandomMode::COUNTER) return counter_random.GetUInt(step, pos, purpose, n);
+            return GetActionRandom().GetUInt(n);
+        }
+
+        /**
+         * @brief Check whether UpdateEcology runs tile by tile
+         *
+         * Tiles run in parallel when there are worker threads; in COUNTER
+         * random mode they are also used, one after another, on one thread.
+         * @return True if a tiling is active
+         */
+        bool IsParallel() const { return !tiles.empty(); }
+
+        /**
+         * @brief Get the generator organisms should draw from for their actions
+         * @return The current tile's stream in parallel mode, else the world's generator
+         */
+        emp::Random & GetActionRandom() {
+            return active_tile ? active_tile->random : random;
+        }
+
+        /**
+         * @brief Get the counters the calling thread should record events in
+         *
+         * Used by the AE_COUNT and AE_PHASE_TIMER hooks; each tile has its own
+         * counters so worker threads never contend on one.
+         * @return The current tile's counters in parallel mode, else the serial counters
+         */
+        EcologyCounters & GetThreadCounters() {
+            return active_tile ? active_tile->counters : serial_counters;
+        }
+
+        /**
+         * @brief Fold this step's per-thread counters into the step and total counters
+         *
+         * UpdateEcology calls this at the end of every step when built with
+         * AE_INSTRUMENT; code driving the serial phases directly calls it
+         * after each step.
+         */
+        void MergeStepCounters() {
+            step_counters = serial_counters;
+            serial_counters.Reset();
+            for (Tile & tile : tiles) {
+                step_counters.Merge(tile.counters);
+                tile.counters.Reset();
+            }
+            total_counters.Merge(step_counters);
+        }
+
+        /**
+         * @brief Get the events and phase times of the last finished step
+         * @return Counters (all zero unless built with AE_INSTRUMENT)
+         */
+        const EcologyCounters & GetStepCounters() const { return step_counters; }
+
+        /**
+         * @brief Get the events and phase times summed over every finished step
+         * @return Counters (all zero unless built with AE_INSTRUMENT)
+         */
+        const EcologyCounters & GetTotalCounters() const { return total_counters; }
+
+        /**
+         * @brief Get running statistics of the organisms in the world
+         *
+         * Kept current by every placement, removal and energy change, so
+         * reading them does not scan the grid. Inside UpdateEcology changes
+         * made on worker threads are merged after each pass.
+         * @return Per-species counts, energy totals and energy histograms
+         */
+        const PopulationStats & GetStats() const { return stats; }
+
+        /**
+         * @brief Recompute the running statistics with a full scan
+         *
+         * Energy totals are running sums, so they can drift by rounding over
+         * very long runs; this resets them exactly.
+         */
+        void RecountStats() {
+            stats.Reset();
+            for (size_t i = 0; i < GetSize(); i++) {
+                if (IsOccupied(i)) stats.Add(pop[i]->GetSpecies(), pop[i]->GetPoints());
+            }
+        }
+
+        /**
+         * @brief Change the energy of the organism in a cell
+         * @param pos Position index (must be occupied)
+         * @param points Points to add (can be negative)
+         */
+        void AddPoints(size_t pos, double points) {
+            Organism & org = *pop[pos];
+            const double before = org.GetPoints();
+            org.AddPoints(points);
+            StatsChanged(org, before);
+        }
+
+        /**
+         * @brief Place an organism, replacing any organism already there
+         * @param org Organism to place
+         * @param pos Position index
+         */
+        void AddOrgAt(emp::Ptr<Organism> org, size_t pos) {
+            if (IsOccupied(pos)) {
+                UpdateNeighborMasks(pos, pop[pos]->GetSpecies(), false);
+                ThreadStats().Remove(pop[pos]->GetSpecies(), pop[pos]->GetPoints());
+                pop[pos].Delete();
+                AdjustOrgCount(-1);
+            } else {
+                ListOccupied(pos);
+            }
+            pop[pos] = org;
+            UpdateNeighborMasks(pos, org->GetSpecies(), true);
+            ThreadStats().Add(org->GetSpecies(), org->GetPoints());
+            AdjustOrgCount(1);
+        }
+
         /**
          * @brief Update all organisms in the world for one simulation step
          * 
          * Processes each organism in random order, handling predation,
          * feeding, movement, reproduction, and death. This method was moved
          * from AEAnimate.cpp to centralize world management logic.
+         *
+         * In SYNCHRONOUS mode nobody acts first. Every organism reads the grid
+         * as the previous step left it, and the results are written into a
+         * second grid that replaces the first at the end of the step:
+         * - Mice graze on the grass around them at the start of the step.
+         * - Each owl picks a prey mouse. When several owls pick the same
+         *   mouse, the one with the lowest priority draw catches it. The rest
+         *   starve this step and stay where they are. A caught mouse does not
+         *   feed or breed.
+         * - A parent places its offspring in the first cell around it that
+         *   was empty at the start of the step. When several parents pick the
+         *   same cell, the lowest priority draw wins. The others keep their
+         *   energy and have no offspring this step.
+         * - Organisms left with no energy are simply not written to the new
+         *   grid, so no separate death sweep is needed.
+         * Then organisms move as with MoveMode::TWO_PHASE. Every draw is
+         * keyed by step and cell, and every cell of the new grid depends only
+         * on the old one, so each pass runs over all tiles at once when there
+         * are threads. Trajectories differ from ASYNCHRONOUS.
          */
         void UpdateEcology() {
-            // Process each organism in random order
-            emp::vector<size_t> action_schedule = emp::GetPermutation(random, GetSize());
-            for (size_t i : action_schedule) {
-                if (IsOccupied(i)) {
-                    ProcessOrganism(i);
-                }
+            if (update_mode == UpdateMode::SYNCHRONOUS) {
+                UpdateEcologySynchronous();
+            } else if (IsParallel()) {
+                UpdateEcologyTiled();
+            } else {
+                // Process each organism in random order
+                ProcessSchedule(MakeActionSchedule());
+
+                // Remove dead organisms
+                RemoveDeadOrganisms();
+
+                // Move organisms randomly
+                MoveOrganisms();
             }
-            
-            // Remove dead organisms
-            RemoveDeadOrganisms();
-            
-            // Move organisms randomly
-            MoveOrganisms();
+            step++;
+
+#if AE_INSTRUMENT
+            MergeStepCounters();
+#endif
         }
 
         /**
          * @brief Extract organism from the population without deleting
+         *
+         * The caller takes ownership and must hand the organism back with
+         * AddOrgAt (or delete it); the world no longer counts it.
          * @param i Position index
          * @return Pointer to extracted organism or nullptr if position empty
          */
@@ -71,7 +596,11 @@ class OrgWorld : public emp::World<Organism> {
             if (!IsOccupied(i)) return nullptr;
             
             emp::Ptr<Organism> org = pop[i];
+            UpdateNeighborMasks(i, org->GetSpecies(), false);
+            ThreadStats().Remove(org->GetSpecies(), org->GetPoints());
+            UnlistOccupied(i);
             pop[i] = nullptr;
+            AdjustOrgCount(-1);
             return org;
         }
 
@@ -82,24 +611,29 @@ class OrgWorld : public emp::World<Organism> {
          */
         bool MoveOrganism(size_t i) {
             if (!IsOccupied(i)) return false;
+            if (random_mode == RandomMode::COUNTER) return MoveOrganismWithin(i, random);
             
             emp::WorldPosition new_pos = GetRandomNeighborPos(i);
             if (!new_pos.IsValid() || IsOccupied(new_pos)) {
                 return false;
             }
             
-            emp::Ptr<Organism> org = ExtractOrganism(i);
-            AddOrgAt(org, new_pos);
+            RelocateOrganism(i, new_pos.GetIndex());
             return true;
         }
 
         /**
-         * @brief Remove organism from the world
+         * @brief Remove organism from the world and free it
          * @param i Position index
          */
         void RemoveOrganism(size_t i) {
             if (IsOccupied(i)) {
+                UpdateNeighborMasks(i, pop[i]->GetSpecies(), false);
+                ThreadStats().Remove(pop[i]->GetSpecies(), pop[i]->GetPoints());
+                UnlistOccupied(i);
+                pop[i].Delete();
                 pop[i] = nullptr;
+                AdjustOrgCount(-1);
             }
         }
 
@@ -108,24 +642,12 @@ class OrgWorld : public emp::World<Organism> {
          * @param i Position to check around
          * @return Array with [mouse_count, owl_count, grass_count]
          */
-        std::array<int, 3> CheckNeighbors(size_t i) {
-            emp::vector<size_t> neighbor_ids = GetValidNeighborOrgIDs(i);
-            int mouse_count = 0;
-            int owl_count = 0;
-            int grass_count = 8; // Start with all cells as grass (8 neighbors)
-            
-            for (size_t j : neighbor_ids) {
-                if (IsOccupied(j)) {
-                    if (pop[j]->GetSpecies() == 0) { // Mouse
-                        mouse_count++;
-                        grass_count--;
-                    } else if (pop[j]->GetSpecies() == 1) { // Owl
-                        owl_count++;
-                        grass_count--;
-                    }
-                }
-            }
-            
+        std::array<int, 3> CheckNeighbors(size_t i) const {
+            const int mouse_count = static_cast<int>(MaskCount(GetMouseMask(i)));
+            const int owl_count = static_cast<int>(MaskCount(GetOwlMask(i)));
+            // Every neighbor that is not a mouse or an owl is grass
+            const int grass_count = 8 - mouse_count - owl_count;
+
             std::array<int, 3> output = {mouse_count, owl_count, grass_count};
             return output;
         }
@@ -136,6 +658,7 @@ class OrgWorld : public emp::World<Organism> {
          * @param width Grid width
          * @param height Grid height
          * @return Vector of neighboring positions with toroidal wrapping
+         * @deprecated Use GetNeighbors, which knows the world's dimensions and does not allocate
          */
         std::vector<size_t> GetNeighborPositions(size_t pos, int width, int height) {
             std::vector<size_t> neighbors;
@@ -158,24 +681,65 @@ class OrgWorld : public emp::World<Organism> {
             return neighbors;
         }
 
-    private:
+        // Serial update phases, in the order UpdateEcology runs them. Exposed
+        // so benchmarks can time each one; calling them in sequence is
+        // exactly one serial UpdateEcology.
+
         /**
-         * @brief Process a single organism's behavior
-         * @param pos Position of organism to process
+         * @brief Draw the random order in which cells act this step
+         * @return Permutation of all cell positions, or of the occupied ones in
+         *         ACTIVE_LIST mode (valid until the next call)
          */
-        void ProcessOrganism(size_t pos) {
-            if (!IsOccupied(pos)) return;
-            
-            // Use the new ProcessInWorld method for polymorphic behavior
-            pop[pos]->ProcessInWorld(*this, pos);
+        const emp::vector<size_t> & MakeActionSchedule() {
+            AE_PHASE_TIMER(*this, SCHEDULE);
+            if (TracksOccupied()) {
+                if (random_mode == RandomMode::COUNTER) CounterShuffle(occupied_cells);
+                else emp::Shuffle(random, occupied_cells);
+                for (size_t k = 0; k < occupied_cells.size(); k++) occupied_slot[occupied_cells[k]] = k;
+                // Births and deaths reorder the list while organisms act
+                action_schedule.assign(occupied_cells.begin(), occupied_cells.end());
+            } else if (random_mode == RandomMode::COUNTER) {
+                action_schedule.resize(GetSize());
+                for (size_t i = 0; i < GetSize(); i++) action_schedule[i] = i;
+                CounterShuffle(action_schedule);
+            } else {
+                action_schedule = emp::GetPermutation(random, GetSize());
+            }
+            return action_schedule;
+        }
+
+        /**
+         * @brief Let the organism in each scheduled cell act
+         * @param action_schedule Cells in processing order
+         */
+        void ProcessSchedule(const emp::vector<size_t> & action_schedule) {
+            AE_PHASE_TIMER(*this, PROCESS);
+            for (size_t i : action_schedule) {
+                if (IsOccupied(i)) {
+                    ProcessOrganism(i);
+                }
+            }
         }
 
         /**
          * @brief Remove dead organisms from the world
          */
         void RemoveDeadOrganisms() {
+            AE_PHASE_TIMER(*this, REMOVE_DEAD);
+            if (TracksOccupied()) {
+                // Removal only touches the dead organism's cell, so order does not matter
+                sweep_cells.assign(occupied_cells.begin(), occupied_cells.end());
+                for (size_t i : sweep_cells) {
+                    if (IsOrganismDead(i)) {
+                        AE_COUNT(*this, starvation_deaths);
+                        RemoveOrganism(i);
+                    }
+                }
+                return;
+            }
             for (size_t i = 0; i < GetSize(); i++) {
                 if (IsOrganismDead(i)) {
+                    AE_COUNT(*this, starvation_deaths);
                     RemoveOrganism(i);
                 }
             }
@@ -185,13 +749,585 @@ class OrgWorld : public emp::World<Organism> {
          * @brief Move organisms randomly based on movement probability
          */
         void MoveOrganisms() {
+            AE_PHASE_TIMER(*this, MOVE);
+            if (move_mode == MoveMode::TWO_PHASE) {
+                MoveOrganismsTwoPhase();
+                return;
+            }
+            if (TracksOccupied()) {
+                // Moves reorder the list, so walk the cells occupied before any of them
+                sweep_cells.assign(occupied_cells.begin(), occupied_cells.end());
+                for (size_t i : sweep_cells) {
+                    if (IsOccupied(i) && RollMove(i, random)) {
+                        AE_COUNT(*this, moves_attempted);
+                        if (MoveOrganism(i)) AE_COUNT(*this, moves_succeeded);
+                    }
+                }
+                return;
+            }
+            for (size_t i = 0; i < GetSize(); i++) {
+                if (IsOccupied(i) && RollMove(i, random)) {
+                    AE_COUNT(*this, moves_attempted);
+                    if (MoveOrganism(i)) AE_COUNT(*this, moves_succeeded);
+                }
+            }
+        }
+
+    private:
+        /**
+         * @brief Record a change in the number of organisms
+         *
+         * In parallel mode the change is kept on the active tile and merged
+         * once its phase finishes, so worker threads never share the counter.
+         * @param delta Change in organism count
+         */
+        void AdjustOrgCount(long delta) {
+            if (active_tile) active_tile->org_delta += delta;
+            else num_orgs += delta;
+        }
+
+        /**
+         * @brief Move an organism to an empty cell
+         *
+         * Same result as ExtractOrganism followed by AddOrgAt, without
+         * touching the organism count or the statistics, which do not change.
+         * @param from Position of the organism
+         * @param to Empty position to move it to
+         */
+        void RelocateOrganism(size_t from, size_t to) {
+            emp::Ptr<Organism> org = pop[from];
+            const int species = org->GetSpecies();
+            UpdateNeighborMasks(from, species, false);
+            UnlistOccupied(from);
+            pop[from] = nullptr;
+            ListOccupied(to);
+            pop[to] = org;
+            UpdateNeighborMasks(to, species, true);
+        }
+
+        /**
+         * @brief Get the statistics the calling thread should record changes in
+         *
+         * Like AdjustOrgCount, changes on a worker thread are kept on the
+         * active tile until its pass finishes.
+         * @return The current tile's pending changes in parallel mode, else the world's statistics
+         */
+        PopulationStats & ThreadStats() {
+            if (!active_tile) return stats;
+            active_tile->stats_changed = true;
+            return active_tile->stats_delta;
+        }
+
+        /**
+         * @brief Record that an organism's energy changed
+         * @param org Organism whose energy changed (in the world)
+         * @param before Its energy before the change
+         */
+        void StatsChanged(const Organism & org, double before) {
+            ThreadStats().Change(org.GetSpecies(), before, org.GetPoints());
+        }
+
+        /**
+         * @brief Flag or clear an organism in the neighbor masks around it
+         *
+         * Touches the 8 cells around pos, which in parallel mode may lie one
+         * cell beyond the tile border the organism itself is on.
+         * @param pos Position of the organism
+         * @param species Its species (only mice and owls are tracked)
+         * @param present True when it arrives, false when it leaves
+         */
+        void UpdateNeighborMasks(size_t pos, int species, bool present) {
+            if (species != 0 && species != 1) return; // Mouse = 0, owl = 1
+            const NeighborList neighbors = GetNeighbors(pos);
+            for (size_t k = 0; k < neighbors.size(); k++) {
+                const uint16_t bit = uint16_t(1) << (NeighborStencil::Opposite(k) + 8 * species);
+                if (present) neighbor_masks[neighbors[k]] |= bit;
+                else neighbor_masks[neighbors[k]] &= uint16_t(~bit);
+            }
+        }
+
+        /**
+         * @brief Check whether the occupied-cell list is being maintained
+         * @return True in ACTIVE_LIST mode while the update is serial
+         */
+        bool TracksOccupied() const {
+            return schedule_mode == ScheduleMode::ACTIVE_LIST && !IsParallel();
+        }
+
+        /**
+         * @brief Add a newly occupied cell to the active list
+         * @param pos Position index (must not be listed)
+         */
+        void ListOccupied(size_t pos) {
+            if (!TracksOccupied()) return;
+            occupied_slot[pos] = occupied_cells.size();
+            occupied_cells.push_back(pos);
+        }
+
+        /**
+         * @brief Drop a cell from the active list by swapping in the last entry
+         * @param pos Position index (must be listed)
+         */
+        void UnlistOccupied(size_t pos) {
+            if (!TracksOccupied()) return;
+            const size_t slot = occupied_slot[pos];
+            const size_t last = occupied_cells.back();
+            occupied_cells[slot] = last;
+            occupied_slot[last] = slot;
+            occupied_cells.pop_back();
+            occupied_slot[pos] = NOT_LISTED;
+        }
+
+        /**
+         * @brief Rebuild the active list from the population, or free it
+         */
+        void RebuildOccupiedList() {
+            occupied_cells.clear();
+            occupied_slot.clear();
+            if (!TracksOccupied()) return;
+            occupied_slot.assign(GetSize(), NOT_LISTED);
+            for (size_t i = 0; i < GetSize(); i++) {
+                if (IsOccupied(i)) ListOccupied(i);
+            }
+        }
+
+        /**
+         * @brief Recompute every neighbor mask from the population
+         */
+        void RebuildNeighborMasks() {
+            neighbor_masks.assign(GetSize(), 0);
             for (size_t i = 0; i < GetSize(); i++) {
-                if (IsOccupied(i) && random.P(MOVE_PROBABILITY)) {
-                    MoveOrganism(i);
+                if (IsOccupied(i)) UpdateNeighborMasks(i, pop[i]->GetSpecies(), true);
+            }
+        }
+
+        /**
+         * @brief Split the grid into tiles for parallel mode
+         *
+         * Uses an even number of tiles along each axis so the 2x2 coloring
+         * stays valid across the toroidal wrap. Falls back to the serial
+         * update if the grid is too small to tile.
+         */
+        void BuildTiles() {
+            tiles.clear();
+            const size_t width = GetWidth();
+            const size_t height = GetHeight();
+            const bool tiled = num_threads > 1 || random_mode == RandomMode::COUNTER;
+            if (!tiled || width * height != GetSize()) return;
+
+            const size_t side = tile_side > MIN_TILE_SIDE ? tile_side : MIN_TILE_SIDE;
+            size_t tiles_x = (width / side) & ~size_t(1);
+            size_t tiles_y = (height / side) & ~size_t(1);
+            if (tiles_x < 2) tiles_x = 2;
+            if (tiles_y < 2) tiles_y = 2;
+            if (width / tiles_x < MIN_TILE_SIDE || height / tiles_y < MIN_TILE_SIDE) return;
+
+            tiles.resize(tiles_x * tiles_y);
+            for (size_t ty = 0; ty < tiles_y; ty++) {
+                for (size_t tx = 0; tx < tiles_x; tx++) {
+                    Tile & tile = tiles[ty * tiles_x + tx];
+                    tile.x0 = tx * width / tiles_x;
+                    tile.x1 = (tx + 1) * width / tiles_x;
+                    tile.y0 = ty * height / tiles_y;
+                    tile.y1 = (ty + 1) * height / tiles_y;
+                    tile.color = (tx % 2) + 2 * (ty % 2);
+                    ResetTileCells(tile);
+                }
+            }
+        }
+
+        /**
+         * @brief Fill a tile's cell list in row order
+         *
+         * Done before every shuffle so a step depends only on the grid and the
+         * world's generator, not on the previous step's order; that keeps
+         * restored checkpoints identical to uninterrupted runs.
+         * @param tile Tile to fill
+         */
+        void ResetTileCells(Tile & tile) const {
+            tile.cells.clear();
+            for (size_t y = tile.y0; y < tile.y1; y++) {
+                for (size_t x = tile.x0; x < tile.x1; x++) {
+                    tile.cells.push_back(y * GetWidth() + x);
+                }
+            }
+        }
+
+        /**
+         * @brief Derive a positive emp::Random seed for one tile and phase
+         * @param step_seed Seed drawn from the world's generator for this step
+         * @param tile_id Index of the tile
+         * @param phase Which pass of the step (0 = actions, 1 = movement)
+         * @return Seed in [1, 2^31)
+         */
+        static int TileSeed(uint32_t step_seed, size_t tile_id, uint32_t phase) {
+            uint64_t z = (uint64_t(step_seed) << 32) ^ (uint64_t(tile_id) << 2) ^ phase;
+            z += 0x9E3779B97F4A7C15ull;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+            return static_cast<int>(z % 0x7FFFFFFEull) + 1;
+        }
+
+        /**
+         * @brief Run fn on every tile of each color, one color at a time
+         * @param fn Work to do for a tile; runs with that tile active on its thread
+         */
+        void ForEachTileByColor(const std::function<void(Tile &)> & fn) {
+            for (size_t color = 0; color < NUM_COLORS; color++) {
+                ForEachTile([&](Tile & tile) {
+                    if (tile.color == color) fn(tile);
+                });
+            }
+        }
+
+        /**
+         * @brief Run fn on every tile in parallel and merge organism counts
+         * @param fn Work to do for a tile; must only move organisms within that
+         *           tile and its one-cell border (their neighbor masks reach one
+         *           cell further)
+         */
+        void ForEachTile(const std::function<void(Tile &)> & fn) {
+            auto run_tile = [&](size_t id) {
+                active_tile = &tiles[id];
+                fn(tiles[id]);
+                active_tile = nullptr;
+            };
+            if (thread_pool) {
+                thread_pool->ParallelFor(tiles.size(), run_tile);
+            } else {
+                for (size_t id = 0; id < tiles.size(); id++) run_tile(id);
+            }
+            for (Tile & tile : tiles) {
+                num_orgs += tile.org_delta;
+                tile.org_delta = 0;
+                if (tile.stats_changed) {
+                    stats.Merge(tile.stats_delta);
+                    tile.stats_delta.Reset();
+                    tile.stats_changed = false;
+                }
+            }
+        }
+
+        /**
+         * @brief Parallel version of UpdateEcology over the tiling
+         */
+        void UpdateEcologyTiled() {
+            // Counter draws are keyed by step and cell, so no per-step seed is needed
+            const uint32_t step_seed = random_mode == RandomMode::COUNTER ? 0 : random.GetUInt();
+            ProcessTiles(step_seed);
+            RemoveDeadTiles();
+            MoveTiles(step_seed);
+        }
+
+        /**
+         * @brief Let every tile process its own cells in its own random order
+         *
+         * The per-tile shuffles are timed as part of the process phase.
+         * @param step_seed Seed drawn from the world's generator for this step
+         */
+        void ProcessTiles(uint32_t step_seed) {
+            AE_PHASE_TIMER(*this, PROCESS);
+            ForEachTileByColor([&](Tile & tile) {
+                ResetTileCells(tile);
+                if (random_mode == RandomMode::COUNTER) {
+                    CounterShuffle(tile.cells, &tile - tiles.data());
+                } else {
+                    tile.random.ResetSeed(TileSeed(step_seed, &tile - tiles.data(), 0));
+                    emp::Shuffle(tile.random, tile.cells);
+                }
+                for (size_t i : tile.cells) {
+                    if (IsOccupied(i)) {
+                        ProcessOrganism(i);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Remove dead organisms from every tile
+         *
+         * Death only touches the organism's own cell, so all tiles run at once.
+         */
+        void RemoveDeadTiles() {
+            AE_PHASE_TIMER(*this, REMOVE_DEAD);
+            ForEachTile([&](Tile & tile) {
+                for (size_t i : tile.cells) {
+                    if (IsOrganismDead(i)) {
+                        AE_COUNT(*this, starvation_deaths);
+                        RemoveOrganism(i);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Move organisms, scanning each tile in index order like MoveOrganisms
+         * @param step_seed Seed drawn from the world's generator for this step
+         */
+        void MoveTiles(uint32_t step_seed) {
+            AE_PHASE_TIMER(*this, MOVE);
+            if (move_mode == MoveMode::TWO_PHASE) {
+                MoveTilesTwoPhase();
+                return;
+            }
+            ForEachTileByColor([&](Tile & tile) {
+                tile.random.ResetSeed(TileSeed(step_seed, &tile - tiles.data(), 1));
+                for (size_t y = tile.y0; y < tile.y1; y++) {
+                    for (size_t x = tile.x0; x < tile.x1; x++) {
+                        const size_t i = y * GetWidth() + x;
+                        if (IsOccupied(i) && RollMove(i, tile.random)) {
+                            AE_COUNT(*this, moves_attempted);
+                            if (MoveOrganismWithin(i, tile.random)) AE_COUNT(*this, moves_succeeded);
+                        }
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Size the move proposal buffers for the current modes and grid
+         */
+        void ResetMoveProposals() {
+            const bool two_phase = move_mode == MoveMode::TWO_PHASE || update_mode == UpdateMode::SYNCHRONOUS;
+            move_claims.Reset(two_phase ? GetSize() : 0);
+        }
+
+        /**
+         * @brief Size the second grid and claim buffers of SYNCHRONOUS mode
+         */
+        void ResetSynchronousBuffers() {
+            const size_t size = update_mode == UpdateMode::SYNCHRONOUS ? GetSize() : 0;
+            hunt_claims.Reset(size);
+            birth_claims.Reset(size);
+            next_points.assign(size, 0.0);
+            next_pop.assign(size, nullptr);
+        }
+
+        /**
+         * @brief Get the keys a pass of keyed claims draws from
+         * @return counter_random in COUNTER mode, else step_random freshly seeded
+         */
+        const CounterRandom & StepKeys() {
+            if (random_mode == RandomMode::COUNTER) return counter_random;
+            step_random.SetSeed(random.GetUInt());
+            return step_random;
+        }
+
+        /**
+         * @brief Record where the organism in a cell wants to move, if anywhere
+         *
+         * Only reads the grid, so cells can propose on any thread.
+         * @param i Position index
+         * @param keys Keys for this step's draws
+         */
+        void ProposeMove(size_t i, const CounterRandom & keys) {
+            move_claims.target[i] = CellClaims::NONE;
+            if (!IsOccupied(i) || !keys.P(step, i, RandomPurpose::MOVE, MOVE_PROBABILITY)) return;
+            AE_COUNT(*this, moves_attempted);
+            const size_t target = stencil.InBlock(i, keys.GetUInt(step, i, RandomPurpose::MOVE_TARGET, 9));
+            if (IsOccupied(target)) return; // Includes staying put
+            move_claims.target[i] = target;
+            move_claims.priority[i] = static_cast<uint32_t>(keys.GetBits(step, i, RandomPurpose::MOVE_PRIORITY));
+        }
+
+        /**
+         * @brief Move the organism in a cell if its proposal won
+         *
+         * Targets were empty when proposed and each has one winner, so no
+         * applied move can block or displace another, whatever the order.
+         * @param i Position index
+         */
+        void ApplyMove(size_t i) {
+            if (!move_claims.Wins(i, stencil)) return;
+            RelocateOrganism(i, move_claims.target[i]);
+            AE_COUNT(*this, moves_succeeded);
+        }
+
+        /**
+         * @brief Serial two-phase movement over the grid or the active list
+         */
+        void MoveOrganismsTwoPhase() {
+            const CounterRandom & keys = StepKeys();
+            if (TracksOccupied()) {
+                sweep_cells.assign(occupied_cells.begin(), occupied_cells.end());
+                for (size_t i : sweep_cells) ProposeMove(i, keys);
+                for (size_t i : sweep_cells) ApplyMove(i);
+                // Cells off next step's list are not overwritten, so clear them now
+                for (size_t i : sweep_cells) move_claims.target[i] = CellClaims::NONE;
+                return;
+            }
+            for (size_t i = 0; i < GetSize(); i++) ProposeMove(i, keys);
+            for (size_t i = 0; i < GetSize(); i++) ApplyMove(i);
+        }
+
+        /**
+         * @brief Two-phase movement with every tile proposing at once
+         *
+         * Applying a move updates neighbor masks up to two cells from the
+         * mover's tile, so the winners are applied one color at a time.
+         */
+        void MoveTilesTwoPhase() {
+            const CounterRandom & keys = StepKeys();
+            ForEachTile([&](Tile & tile) {
+                for (size_t y = tile.y0; y < tile.y1; y++) {
+                    for (size_t x = tile.x0; x < tile.x1; x++) ProposeMove(y * GetWidth() + x, keys);
+                }
+            });
+            ForEachTileByColor([&](Tile & tile) {
+                for (size_t y = tile.y0; y < tile.y1; y++) {
+                    for (size_t x = tile.x0; x < tile.x1; x++) ApplyMove(y * GetWidth() + x);
+                }
+            });
+        }
+
+        /**
+         * @brief Run fn on every cell, over all tiles at once when there is a tiling
+         * @param fn Work for one cell; may only write that cell's entries
+         */
+        template <typename FN>
+        void ForEachCell(FN && fn) {
+            if (!IsParallel()) {
+                for (size_t i = 0; i < GetSize(); i++) fn(i);
+                return;
+            }
+            ForEachTile([&](Tile & tile) {
+                for (size_t y = tile.y0; y < tile.y1; y++) {
+                    for (size_t x = tile.x0; x < tile.x1; x++) fn(y * GetWidth() + x);
                 }
+            });
+        }
+
+        /**
+         * @brief Compute a cell's neighbor mask from the organisms around it
+         * @param pos Position index
+         * @return Mask as kept in neighbor_masks
+         */
+        uint16_t GatherNeighborMask(size_t pos) const {
+            const NeighborList neighbors = GetNeighbors(pos);
+            uint16_t mask = 0;
+            for (size_t k = 0; k < neighbors.size(); k++) {
+                if (!IsOccupied(neighbors[k])) continue;
+                const int species = pop[neighbors[k]]->GetSpecies();
+                if (species == 0 || species == 1) mask |= uint16_t(1) << (k + 8 * species); // Mouse = 0, owl = 1
+            }
+            return mask;
+        }
+
+        /**
+         * @brief SYNCHRONOUS version of UpdateEcology
+         *
+         * Hunts are claimed, then every organism's new energy and offspring
+         * claim is worked out, then the new grid is written cell by cell;
+         * each pass only reads the old grid and the earlier passes' claims.
+         */
+        void UpdateEcologySynchronous() {
+            {
+                AE_PHASE_TIMER(*this, PROCESS);
+                const CounterRandom & keys = StepKeys();
+                ForEachCell([&](size_t i) { ProposeHunt(i, keys); });
+                ForEachCell([&](size_t i) { ResolveSynchronousCell(i, keys); });
+                num_orgs = 0;
+                stats.Reset();
+                ForEachCell([&](size_t i) { WriteSynchronousCell(i); });
             }
+            {
+                AE_PHASE_TIMER(*this, REMOVE_DEAD);
+                pop.swap(next_pop);
+                ForEachCell([&](size_t i) {
+                    next_pop[i] = nullptr;
+                    neighbor_masks[i] = GatherNeighborMask(i);
+                });
+                if (TracksOccupied()) RebuildOccupiedList();
+            }
+            AE_PHASE_TIMER(*this, MOVE);
+            if (IsParallel()) MoveTilesTwoPhase();
+            else MoveOrganismsTwoPhase();
         }
 
+        // SYNCHRONOUS passes over one cell. Defined in Species.h, which knows
+        // each species' feeding and reproduction rules.
+
+        /**
+         * @brief Record which mouse the owl in a cell tries to catch, if any
+         * @param pos Position index
+         * @param keys Keys for this step's draws
+         */
+        inline void ProposeHunt(size_t pos, const CounterRandom & keys);
+
+        /**
+         * @brief Work out a cell's organism's energy and claim a cell for its offspring
+         * @param pos Position index
+         * @param keys Keys for this step's draws
+         */
+        inline void ResolveSynchronousCell(size_t pos, const CounterRandom & keys);
+
+        /**
+         * @brief Get the energy an organism ends the step with, after paying for offspring
+         * @param pos Position the organism started the step in
+         * @return Energy points (at most 0 means it dies)
+         */
+        inline double SynchronousPoints(size_t pos) const;
+
+        /**
+         * @brief Fill one cell of the new grid and free organisms that died there
+         * @param pos Position index
+         */
+        inline void WriteSynchronousCell(size_t pos);
+
+        /**
+         * @brief Decide whether the organism in a cell tries to move
+         * @param i Position of the organism
+         * @param rng Stream to draw from in SHARED_STREAM mode
+         * @return True with probability MOVE_PROBABILITY
+         */
+        bool RollMove(size_t i, emp::Random & rng) {
+            if (random_mode == RandomMode::COUNTER) return counter_random.P(step, i, RandomPurpose::MOVE, MOVE_PROBABILITY);
+            return rng.P(MOVE_PROBABILITY);
+        }
+
+        /**
+         * @brief Shuffle cells with draws keyed by slot rather than call order
+         *
+         * The result depends only on the seed, the step, the input order and
+         * the slot range, not on any draws made before.
+         * @param cells Cells to shuffle in place
+         * @param tile Index of the tile the cells belong to (0 for a whole-grid list);
+         *             each tile keys its own range of GetSize() slots
+         */
+        void CounterShuffle(emp::vector<size_t> & cells, size_t tile = 0) const {
+            counter_random.Shuffle(step, tile * GetSize(), cells);
+        }
+
+        /**
+         * @brief Move organism to a random neighboring position using a given stream
+         *
+         * Picks from the 3x3 block around the organism (the cell itself
+         * included), like emp::World::GetRandomNeighborPos on a grid.
+         * @param i Current position of organism
+         * @param rng Random stream to draw from in SHARED_STREAM mode
+         * @return True if organism was successfully moved
+         */
+        bool MoveOrganismWithin(size_t i, emp::Random & rng) {
+            const size_t offset = random_mode == RandomMode::COUNTER
+                ? counter_random.GetUInt(step, i, RandomPurpose::MOVE_TARGET, 9)
+                : rng.GetUInt(9);
+            const size_t new_pos = stencil.InBlock(i, offset);
+            if (IsOccupied(new_pos)) return false;
+
+            RelocateOrganism(i, new_pos);
+            return true;
+        }
+
+        /**
+         * @brief Process a single organism's behavior
+         *
+         * Defined in Species.h, where every registered species is complete,
+         * as a compile-time switch over the species instead of a virtual call.
+         * @param pos Position of organism to process
+         */
+        inline void ProcessOrganism(size_t pos);
+
         /**
          * @brief Check if organism at position is dead (points <= 0)
          * @param pos Position to check
@@ -0,0 +1,446 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "World.h"
+#include "BitGrid.h"
+#include "GridWorld.h"
+#include "ChunkedWorld.h"
+#include "Mouse.h"
+#include "Owl.h"
+#include "Setup.h"
+
+// You run this from going "./compile-run-bench.sh" in the terminal.
+//
+// Times OrgWorld::UpdateEcology phase by phase and GridWorld::UpdateEcology
+// as a whole across grid sizes and mouse/owl densities, plus microbenchmarks
+// of the per-organism hot paths, and prints one JSON document to stdout.
+//
+//   ./ae_bench --sizes 20,256,1024 --densities 4:40,2:20 --cells 20000000
+//
+// --sizes      grid side lengths (square grids)
+// --densities  mouse_ratio:owl_ratio pairs (one placement attempt per N cells)
+// --cells      approximate cell-updates per configuration (sets step counts)
+// --seed       seed for every configuration
+//
+// Build with -DAE_INSTRUMENT=1 to add OrgWorld's event counters to the
+// update_ecology records (phase times then include the timer overhead).
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Seconds elapsed since a start time
+ * @param start Start time
+ * @return Elapsed seconds
+ */
+static double SecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Split a comma-separated list
+ * @param text List text
+ * @return Items in order
+ */
+static emp::vector<std::string> SplitList(const std::string & text) {
+    emp::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+/**
+ * @brief Benchmark settings
+ */
+struct BenchConfig {
+    emp::vector<size_t> sizes = {20, 64, 256, 1024, 4096};                       ///< Grid side lengths
+    emp::vector<std::pair<int, int>> densities = {{4, 40}, {2, 20}, {16, 160}};  ///< Mouse/owl ratios
+    double target_cells = 2e7;                                                   ///< Cell-updates per configuration
+    int seed = 1;                                                                ///< Seed for every configuration
+};
+
+/**
+ * @brief Collects benchmark records and prints them as JSON
+ */
+class JsonReport {
+    private:
+        emp::vector<std::string> records; ///< One JSON object per record
+
+    public:
+        /**
+         * @brief Add a finished record
+         * @param record JSON object text
+         */
+        void Add(const std::string & record) { records.push_back(record); }
+
+        /**
+         * @brief Print all records
+         * @param out Destination stream
+         */
+        void Print(std::ostream & out) const {
+            out << "{\n  \"benchmarks\": [\n";
+            for (size_t i = 0; i < records.size(); i++) {
+                out << "    " << records[i] << (i + 1 < records.size() ? ",\n" : "\n");
+            }
+            out << "  ]\n}\n";
+        }
+};
+
+/**
+ * @brief Pick how many steps to run so each configuration does similar work
+ * @param cells Cells in the grid
+ * @param config Benchmark settings
+ * @return Step count (at least 1)
+ */
+static size_t StepsFor(size_t cells, const BenchConfig & config) {
+    const size_t steps = static_cast<size_t>(config.target_cells / cells);
+    return steps > 0 ? steps : 1;
+}
+
+/**
+ * @brief Build the EcologyConfig for one benchmark configuration
+ * @param side Grid side length
+ * @param density Mouse and owl density ratios
+ * @return Ecology settings for a square grid
+ */
+static EcologyConfig MakeEcology(size_t side, std::pair<int, int> density) {
+    EcologyConfig ecology;
+    ecology.width = side;
+    ecology.height = side;
+    ecology.mouse_density_ratio = density.first;
+    ecology.owl_density_ratio = density.second;
+    return ecology;
+}
+
+/**
+ * @brief Time OrgWorld::UpdateEcology with each serial phase timed separately
+ * @param side Grid side length
+ * @param density Mouse and owl density ratios
+ * @param config Benchmark settings
+ * @param schedule_mode Full-grid permutation or active-list scheduling
+ * @return JSON record
+ */
+static std::string BenchOrgWorld(size_t side, std::pair<int, int> density, const BenchConfig & config,
+                                 OrgWorld::ScheduleMode schedule_mode) {
+    const EcologyConfig ecology = MakeEcology(side, density);
+    emp::Random random(config.seed);
+    OrgWorld world(random);
+    world.SetPopStruct_Grid(side, side);
+    world.SetScheduleMode(schedule_mode);
+    PopulateWithMice(world, random, ecology);
+    PopulateWithOwls(world, random, ecology);
+
+    const size_t steps = StepsFor(world.GetSize(), config);
+    double schedule = 0.0, process = 0.0, remove_dead = 0.0, move = 0.0;
+    for (size_t step = 0; step < steps; step++) {
+        Clock::time_point start = Clock::now();
+        const emp::vector<size_t> & action_schedule = world.MakeActionSchedule();
+        schedule += SecondsSince(start);
+
+        start = Clock::now();
+        world.ProcessSchedule(action_schedule);
+        process += SecondsSince(start);
+
+        start = Clock::now();
+        world.RemoveDeadOrganisms();
+        remove_dead += SecondsSince(start);
+
+        start = Clock::now();
+        world.MoveOrganisms();
+        move += SecondsSince(start);
+#if AE_INSTRUMENT
+        world.MergeStepCounters();
+#endif
+    }
+
+    const double total = schedule + process + remove_dead + move;
+    std::ostringstream out;
+    const bool active_list = schedule_mode == OrgWorld::ScheduleMode::ACTIVE_LIST;
+    out << "{\"name\": \"update_ecology\", \"engine\": \"" << (active_list ? "org_active" : "org")
+        << "\", \"width\": " << side
+        << ", \"height\": " << side << ", \"mouse_ratio\": " << density.first
+        << ", \"owl_ratio\": " << density.second << ", \"steps\": " << steps
+        << ", \"final_orgs\": " << world.GetNumOrgs() << ", \"seconds\": " << total
+        << ", \"cell_updates_per_second\": " << (world.GetSize() * steps) / total
+        << ", \"phases\": {\"schedule\": " << schedule << ", \"process\": " << process
+        << ", \"remove_dead\": " << remove_dead << ", \"move\": " << move << "}";
+#if AE_INSTRUMENT
+    const EcologyCounters & counters = world.GetTotalCounters();
+    out << ", \"counters\": {\"hunts\": " << counters.hunts << ", \"mouse_births\": " << counters.mouse_births
+        << ", \"owl_births\": " << counters.owl_births << ", \"failed_placements\": " << counters.failed_placements
+        << ", \"starvation_deaths\": " << counters.starvation_deaths
+        << ", \"moves_attempted\": " << counters.moves_attempted
+        << ", \"moves_succeeded\": " << counters.moves_succeeded << "}";
+#endif
+    out << "}";
+    return out.str();
+}
+
+/**
+ * @brief Time GridWorld::UpdateEcology on the same configuration
+ * @param side Grid side length
+ * @param density Mouse and owl density ratios
+ * @param config Benchmark settings
+ * @param snapshot_grazing Whether to use start-of-step bit-plane counts
+ * @param block_schedule Whether to shuffle the grid block by block
+ * @return JSON record
+ */
+static std::string BenchGridWorld(size_t side, std::pair<int, int> density, const BenchConfig & config,
+                                  bool snapshot_grazing, bool block_schedule) {
+    const EcologyConfig ecology = MakeEcology(side, density);
+    emp::Random random(config.seed);
+    GridWorld world(random, side, side);
+    world.SetSnapshotGrazing(snapshot_grazing);
+    world.SetBlockSchedule(block_schedule);
+    PopulateWithMice(world, random, ecology);
+    PopulateWithOwls(world, random, ecology);
+
+    const size_t steps = StepsFor(world.GetSize(), config);
+    const Clock::time_point start = Clock::now();
+    for (size_t step = 0; step < steps; step++) world.UpdateEcology();
+    const double total = SecondsSince(start);
+
+    std::ostringstream out;
+    out << "{\"name\": \"update_ecology\", \"engine\": \"grid" << (snapshot_grazing ? "_snapshot" : "")
+        << (block_schedule ? "_block" : "") << "\", \"width\": " << side
+        << ", \"height\": " << side << ", \"mouse_ratio\": " << density.first
+        << ", \"owl_ratio\": " << density.second << ", \"steps\": " << steps
+        << ", \"final_orgs\": " << world.GetNumOrgs() << ", \"seconds\": " << total
+        << ", \"cell_updates_per_second\": " << (world.GetSize() * steps) / total << "}";
+    return out.str();
+}
+
+/**
+ * @brief Time ChunkedWorld::UpdateEcology on the same configuration
+ * @param side Grid side length
+ * @param density Mouse and owl density ratios
+ * @param config Benchmark settings
+ * @return JSON record
+ */
+static std::string BenchChunkedWorld(size_t side, std::pair<int, int> density, const BenchConfig & config) {
+    const EcologyConfig ecology = MakeEcology(side, density);
+    emp::Random random(config.seed);
+    ChunkedWorld world(random, side, side);
+    PopulateWithMice(world, random, ecology);
+    PopulateWithOwls(world, random, ecology);
+
+    const size_t steps = StepsFor(world.GetSize(), config);
+    const Clock::time_point start = Clock::now();
+    for (size_t step = 0; step < steps; step++) world.UpdateEcology();
+    const double total = SecondsSince(start);
+
+    std::ostringstream out;
+    out << "{\"name\": \"update_ecology\", \"engine\": \"chunked\", \"width\": " << side
+        << ", \"height\": " << side << ", \"mouse_ratio\": " << density.first
+        << ", \"owl_ratio\": " << density.second << ", \"steps\": " << steps
+        << ", \"final_orgs\": " << world.GetNumOrgs() << ", \"active_chunks\": " << world.GetNumActiveChunks()
+        << ", \"seconds\": " << total
+        << ", \"cell_updates_per_second\": " << (world.GetSize() * steps) / total << "}";
+    return out.str();
+}
+
+/**
+ * @brief Time EnsembleWorld::UpdateEcology with one replicate per lane
+ * @param side Grid side length
+ * @param density Mouse and owl density ratios
+ * @param config Benchmark settings (lane l uses seed config.seed + l)
+ * @return JSON record; cell updates count every lane
+ */
+static std::string BenchEnsembleWorld(size_t side, std::pair<int, int> density, const BenchConfig & config) {
+    using Ensemble = EnsembleWorld<>;
+    const EcologyConfig ecology = MakeEcology(side, density);
+    emp::vector<int> seeds;
+    for (size_t lane = 0; lane < Ensemble::NUM_LANES; lane++) seeds.push_back(config.seed + static_cast<int>(lane));
+    Ensemble world(side, side, seeds);
+    for (size_t lane = 0; lane < seeds.size(); lane++) {
+        EnsembleLane<Ensemble::NUM_LANES> view(world, lane);
+        PopulateWithMice(view, world.GetRandom(lane), ecology);
+        PopulateWithOwls(view, world.GetRandom(lane), ecology);
+    }
+
+    const size_t lane_cells = world.GetSize() * seeds.size();
+    const size_t steps = StepsFor(lane_cells, config);
+    const Clock::time_point start = Clock::now();
+    for (size_t step = 0; step < steps; step++) world.UpdateEcology();
+    const double total = SecondsSince(start);
+
+    size_t final_orgs = 0;
+    for (size_t lane = 0; lane < seeds.size(); lane++) final_orgs += world.GetNumOrgs(lane);
+
+    std::ostringstream out;
+    out << "{\"name\": \"update_ecology\", \"engine\": \"ensemble\", \"width\": " << side
+        << ", \"height\": " << side << ", \"mouse_ratio\": " << density.first
+        << ", \"owl_ratio\": " << density.second << ", \"lanes\": " << seeds.size() << ", \"steps\": " << steps
+        << ", \"final_orgs\": " << final_orgs << ", \"seconds\": " << total
+        << ", \"cell_updates_per_second\": " << (lane_cells * steps) / total << "}";
+    return out.str();
+}
+
+/**
+ * @brief Format a microbenchmark record
+ * @param name Benchmark name
+ * @param side Grid side length (0 if not grid-dependent)
+ * @param calls Number of calls timed
+ * @param seconds Total time
+ * @param checksum Value folded from the results so the work is not optimized away
+ * @return JSON record
+ */
+static std::string MicroRecord(const std::string & name, size_t side, size_t calls, double seconds, size_t checksum) {
+    std::ostringstream out;
+    out << "{\"name\": \"" << name << "\", \"width\": " << side << ", \"height\": " << side
+        << ", \"calls\": " << calls << ", \"seconds\": " << seconds
+        << ", \"ns_per_call\": " << seconds * 1e9 / calls
+        << ", \"calls_per_second\": " << calls / seconds << ", \"checksum\": " << checksum << "}";
+    return out.str();
+}
+
+/**
+ * @brief Microbenchmarks of the neighbor queries on a populated grid
+ * @param side Grid side length
+ * @param config Benchmark settings
+ * @param report Report to add records to
+ */
+static void BenchNeighborQueries(size_t side, const BenchConfig & config, JsonReport & report) {
+    const EcologyConfig ecology = MakeEcology(side, {4, 40});
+    emp::Random random(config.seed);
+    OrgWorld world(random);
+    world.SetPopStruct_Grid(side, side);
+    PopulateWithMice(world, random, ecology);
+    PopulateWithOwls(world, random, ecology);
+
+    const size_t calls = static_cast<size_t>(config.target_cells / 4);
+    emp::vector<size_t> positions(4096);
+    for (size_t & pos : positions) pos = random.GetUInt(world.GetSize());
+
+    size_t checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        checksum += world.CheckNeighbors(positions[i % positions.size()])[2];
+    }
+    report.Add(MicroRecord("check_neighbors", side, calls, SecondsSince(start), checksum));
+
+    checksum = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        checksum += world.GetNeighbors(positions[i % positions.size()])[7];
+    }
+    report.Add(MicroRecord("get_neighbors", side, calls, SecondsSince(start), checksum));
+
+    checksum = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        checksum += world.GetNeighborPositions(positions[i % positions.size()], side, side)[7];
+    }
+    report.Add(MicroRecord("get_neighbor_positions", side, calls, SecondsSince(start), checksum));
+
+    checksum = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        checksum += Owl::FindNearbyMice(world, positions[i % positions.size()]).size();
+    }
+    report.Add(MicroRecord("owl_find_nearby_mice", side, calls, SecondsSince(start), checksum));
+}
+
+/**
+ * @brief Microbenchmark of whole-grid neighbor counting on bit-planes
+ * @param side Grid side length
+ * @param config Benchmark settings
+ * @param report Report to add records to
+ */
+static void BenchBitGridCounts(size_t side, const BenchConfig & config, JsonReport & report) {
+    const EcologyConfig ecology = MakeEcology(side, {4, 40});
+    emp::Random random(config.seed);
+    GridWorld world(random, side, side);
+    PopulateWithMice(world, random, ecology);
+    PopulateWithOwls(world, random, ecology);
+
+    emp::vector<uint8_t> species(world.GetSize());
+    for (size_t i = 0; i < species.size(); i++) species[i] = world.GetSpecies(i);
+    BitPlane occupied(side, side);
+    NeighborCounter counter;
+    NeighborCounts counts;
+
+    const size_t calls = StepsFor(world.GetSize(), config);
+    size_t checksum = 0;
+    const Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        occupied.Pack(species.data(), GridWorld::EMPTY, false);
+        counter.Count(occupied, counts);
+        checksum += counts.Get(i % side, (i / side) % side);
+    }
+    report.Add(MicroRecord("bitgrid_neighbor_counts", side, calls, SecondsSince(start), checksum));
+}
+
+/**
+ * @brief Microbenchmark of organism allocation and release
+ * @param config Benchmark settings
+ * @param report Report to add records to
+ */
+static void BenchAllocation(const BenchConfig & config, JsonReport & report) {
+    emp::Random random(config.seed);
+    const size_t calls = static_cast<size_t>(config.target_cells / 4);
+    emp::vector<emp::Ptr<Organism>> live(1024, nullptr);
+
+    size_t checksum = 0;
+    const Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        emp::Ptr<Organism> & slot = live[(i * 7919) % live.size()];
+        if (slot) slot.Delete();
+        slot = (i & 1) ? emp::Ptr<Organism>(new Owl(&random, 1.0)) : emp::Ptr<Organism>(new Mouse(&random, 1.0));
+        checksum += slot->GetSpecies();
+    }
+    const double seconds = SecondsSince(start);
+    for (emp::Ptr<Organism> & slot : live) if (slot) slot.Delete();
+    report.Add(MicroRecord("organism_alloc_free", 0, calls, seconds, checksum));
+}
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string flag = argv[i];
+        const std::string value = argv[i + 1];
+        if (flag == "--sizes") {
+            config.sizes.clear();
+            for (const std::string & item : SplitList(value)) config.sizes.push_back(std::stoul(item));
+        } else if (flag == "--densities") {
+            config.densities.clear();
+            for (const std::string & item : SplitList(value)) {
+                const size_t colon = item.find(':');
+                config.densities.emplace_back(std::stoi(item.substr(0, colon)), std::stoi(item.substr(colon + 1)));
+            }
+        } else if (flag == "--cells") {
+            config.target_cells = std::stod(value);
+        } else if (flag == "--seed") {
+            config.seed = std::stoi(value);
+        } else {
+            std::cerr << "ae_bench: unknown flag " << flag << std::endl;
+            return 1;
+        }
+    }
+
+    JsonReport report;
+    for (size_t side : config.sizes) {
+        for (const std::pair<int, int> & density : config.densities) {
+            report.Add(BenchOrgWorld(side, density, config, OrgWorld::ScheduleMode::FULL_PERMUTATION));
+            report.Add(BenchOrgWorld(side, density, config, OrgWorld::ScheduleMode::ACTIVE_LIST));
+            report.Add(BenchGridWorld(side, density, config, false, false));
+            report.Add(BenchGridWorld(side, density, config, true, false));
+            report.Add(BenchGridWorld(side, density, config, false, true));
+            report.Add(BenchChunkedWorld(side, density, config));
+            report.Add(BenchEnsembleWorld(side, density, config));
+        }
+        BenchNeighborQueries(side, config, report);
+        BenchBitGridCounts(side, config, report);
+    }
+    BenchAllocation(config, report);
+
+    report.Print(std::cout);
+    return 0;
+}
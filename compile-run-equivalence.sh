@@ -0,0 +1,2 @@
+g++ -O3 -DNDEBUG -msse4.2 -Wall -Wno-unused-function -std=c++17 -pthread -IEmpirical/include/ equivalence.cpp -o ae_equivalence
+./ae_equivalence "$@"
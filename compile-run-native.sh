@@ -1,2 +1,2 @@
-g++ -O3 -DNDEBUG -msse4.2 -Wall -Wno-unused-function -std=c++17 -IEmpirical/include/ native.cpp -o ae_lab
-./ae_lab
\ No newline at end of file
+g++ -O3 -DNDEBUG -msse4.2 -Wall -Wno-unused-function -std=c++17 -pthread -IEmpirical/include/ native.cpp -o ae_lab
+./ae_lab --steps 10
@@ -1,2 +1,3 @@
 emcc -std=c++17 -IEmpirical/include/ -Os --js-library Empirical/include/emp/web/library_emp.js -s EXPORTED_FUNCTIONS="['_main', '_empCppCallback', '_empDoCppCallback']" -s "EXTRA_EXPORTED_RUNTIME_METHODS=['ccall', 'cwrap']" -s NO_EXIT_RUNTIME=1 AEAnimate.cpp -o AEAnimate.js
+emcc -std=c++17 -IEmpirical/include/ -Os -s BUILD_AS_WORKER=1 -s EXPORTED_FUNCTIONS="['_AdvanceWorld']" AEWorker.cpp -o AEWorker.js
 python3 -m http.server
\ No newline at end of file
@@ -0,0 +1,980 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "emp/base/Ptr.hpp"
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "World.h"
+#include "Checkpoint.h"
+#include "GridWorld.h"
+#include "ChunkedWorld.h"
+#include "EnsembleWorld.h"
+#include "Distributed.h"
+#include "Mouse.h"
+#include "Owl.h"
+#include "Setup.h"
+#include "Analytics.h"
+#include "ThreadPool.h"
+#include "TrajectoryRecorder.h"
+
+// You run this from going "./compile-run-equivalence.sh" in the terminal.
+//
+// Runs the reference OrgWorld and a candidate engine from the same seed and
+// starting population, compares every cell's species and energy after every
+// step, and reports the first step and cell where they differ along with how
+// much faster the candidate stepped than the reference.
+//
+//   ./ae_equivalence --sizes 20,64,256 --steps 200 --engines shuffle,grid,ensemble,tiled,tiled-sync,tiled-two-phase,resume,distributed,chunked,trajectory,clusters
+//
+// --sizes      grid side lengths (square grids)
+// --steps      steps to compare per configuration
+// --seed       seed of the first replicate
+// --engines    candidates to check:
+//                shuffle      CounterRandom::Shuffle, which orders counter-mode and
+//                             tiled steps, reaches every order of 2 to 5 items
+//                             equally often (run once, not per size)
+//                grid         GridWorld against OrgWorld
+//                ensemble     one EnsembleWorld lane per seed against one OrgWorld per seed
+//                tiled        OrgWorld with --random counter on --threads threads
+//                             against the same world on one thread
+//                tiled-sync   as tiled, with both worlds in --update synchronous
+//                tiled-two-phase
+//                             as tiled, with both worlds in --move two-phase
+//                resume       OrgWorld with --schedule active, checkpointed half-way
+//                             and restored into a new world, against the same
+//                             world run without interruption
+//                distributed  DistributedRunner on --processes workers against
+//                             OrgWorld with --random counter (per-step counts and
+//                             the final grid, since workers only report those)
+//                chunked      ChunkedWorld against OrgWorld with --schedule active,
+//                             statistically: each species' mean count over the
+//                             run, across --samples seeds per engine
+//                trajectory   TrajectoryReader::Seek on a recording of every step
+//                             against the grids it was recorded from, with the
+//                             index, cut before the index and cut mid-frame
+//                clusters     SpatialAnalysis::FindClusters against breadth-first
+//                             labeling on random grids of each size (and thin
+//                             ones), split into 4 to 28 row strips
+// --threads    thread count for the tiled candidate
+// --processes  worker count for the distributed candidate
+// --samples    seeds per engine for the chunked candidate (at least 2)
+//
+// Speedups compare only the time spent inside UpdateEcology (the whole run
+// for the distributed candidate). Exits with status 1 if any candidate
+// diverged, so the script can gate a build.
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Seconds elapsed since a start time
+ * @param start Start time
+ * @return Elapsed seconds
+ */
+static double SecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Split a comma-separated list
+ * @param text List text
+ * @return Items in order
+ */
+static emp::vector<std::string> SplitList(const std::string & text) {
+    emp::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+/**
+ * @brief Harness settings
+ */
+struct EquivalenceConfig {
+    emp::vector<size_t> sizes = {20, 64, 256};                                        ///< Grid side lengths
+    emp::vector<std::string> engines = {"shuffle", "grid", "ensemble", "tiled", "tiled-sync", "tiled-two-phase",
+                                                "resume", "distributed", "chunked",
+                                                "trajectory", "clusters"};  ///< Candidates to check
+    size_t steps = 200;                                                               ///< Steps per configuration
+    int seed = 1;                                                                     ///< Seed of the first replicate
+    size_t threads = 4;                                                               ///< Threads for the tiled candidate
+    size_t processes = 2;                                                             ///< Workers for the distributed candidate
+    size_t samples = 16;                                                              ///< Seeds per engine for the chunked candidate
+};
+
+/**
+ * @brief The first cell where a candidate disagreed with the reference
+ */
+struct Divergence {
+    bool found = false;                    ///< Whether any cell differed
+    size_t step = 0;                       ///< Step at which it differed
+    size_t replicate = 0;                  ///< Replicate (seed offset) that differed
+    size_t pos = 0;                        ///< Position index of the cell
+    uint8_t reference_species = 0;         ///< Reference species byte
+    uint8_t candidate_species = 0;         ///< Candidate species byte
+    double reference_points = 0.0;         ///< Reference energy
+    double candidate_points = 0.0;         ///< Candidate energy
+};
+
+/**
+ * @brief One reference OrgWorld replicate with the generator it draws from
+ */
+class Reference {
+    private:
+        emp::Random random;  ///< Generator shared by the world and its organisms
+        OrgWorld world;      ///< Reference world
+
+    public:
+        /**
+         * @brief Build and populate a reference world
+         * @param ecology Grid size and starting population
+         * @param seed Replicate seed
+         * @param counter Use --random counter instead of the shared stream
+         * @param num_threads Threads for the update (counter mode only)
+         * @param schedule Scheduling strategy
+         * @param update Whether organisms act on the live grid or the previous step's
+         * @param move How the movement pass decides and applies moves
+         */
+        Reference(const EcologyConfig & ecology, int seed, bool counter, size_t num_threads = 1,
+                  OrgWorld::ScheduleMode schedule = OrgWorld::ScheduleMode::FULL_PERMUTATION,
+                  OrgWorld::UpdateMode update = OrgWorld::UpdateMode::ASYNCHRONOUS,
+                  OrgWorld::MoveMode move = OrgWorld::MoveMode::SEQUENTIAL)
+            : random(seed), world(random, update) {
+            world.SetPopStruct_Grid(ecology.width, ecology.height);
+            world.SetScheduleMode(schedule);
+            if (counter) world.SetRandomMode(OrgWorld::RandomMode::COUNTER, static_cast<uint32_t>(seed));
+            world.SetMoveMode(move);
+            if (num_threads > 1) world.SetThreads(num_threads);
+            PopulateWithMice(world, random, ecology);
+            PopulateWithOwls(world, random, ecology);
+        }
+
+        Reference(const Reference &) = delete;
+        Reference & operator=(const Reference &) = delete;
+
+        void Step() { world.UpdateEcology(); }
+        const OrgWorld & GetWorld() const { return world; }
+};
+
+/**
+ * @brief Engine under test, covering one or more replicates
+ */
+class Candidate {
+    public:
+        virtual ~Candidate() = default;
+
+        /**
+         * @brief Get how many consecutive seeds the candidate runs
+         * @return Replicate count
+         */
+        virtual size_t GetNumReplicates() const = 0;
+
+        /**
+         * @brief Advance every replicate one step
+         */
+        virtual void Step() = 0;
+
+        /**
+         * @brief Get the species byte of a cell
+         * @param replicate Replicate index
+         * @param pos Position index
+         * @return Species ID, or GridWorld::EMPTY for grass
+         */
+        virtual uint8_t GetSpecies(size_t replicate, size_t pos) const = 0;
+
+        /**
+         * @brief Get the energy of a cell
+         * @param replicate Replicate index
+         * @param pos Position index
+         * @return Energy points (0 for grass)
+         */
+        virtual double GetPoints(size_t replicate, size_t pos) const = 0;
+};
+
+/**
+ * @brief GridWorld populated from the replicate's generator
+ */
+class GridCandidate : public Candidate {
+    private:
+        emp::Random random;  ///< Generator the world draws from
+        GridWorld world;     ///< World under test
+
+    public:
+        GridCandidate(const EcologyConfig & ecology, int seed)
+            : random(seed), world(random, ecology.width, ecology.height) {
+            PopulateWithMice(world, random, ecology);
+            PopulateWithOwls(world, random, ecology);
+        }
+
+        size_t GetNumReplicates() const override { return 1; }
+        void Step() override { world.UpdateEcology(); }
+        uint8_t GetSpecies(size_t, size_t pos) const override { return GetCellSpecies(world, pos); }
+        double GetPoints(size_t, size_t pos) const override { return GetCellPoints(world, pos); }
+};
+
+/**
+ * @brief EnsembleWorld with every lane populated as a GridWorld of its seed
+ */
+class EnsembleCandidate : public Candidate {
+    private:
+        using Ensemble = EnsembleWorld<>;
+        Ensemble world;                                        ///< World under test
+        emp::vector<EnsembleLane<Ensemble::NUM_LANES>> lanes;  ///< One view per lane
+
+    public:
+        EnsembleCandidate(const EcologyConfig & ecology, const emp::vector<int> & seeds)
+            : world(ecology.width, ecology.height, seeds) {
+            for (size_t lane = 0; lane < seeds.size(); lane++) {
+                lanes.emplace_back(world, lane);
+                PopulateWithMice(lanes[lane], world.GetRandom(lane), ecology);
+                PopulateWithOwls(lanes[lane], world.GetRandom(lane), ecology);
+            }
+        }
+
+        size_t GetNumReplicates() const override { return lanes.size(); }
+        void Step() override { world.UpdateEcology(); }
+        uint8_t GetSpecies(size_t replicate, size_t pos) const override { return world.GetSpecies(replicate, pos); }
+        double GetPoints(size_t replicate, size_t pos) const override { return world.GetPoints(replicate, pos); }
+};
+
+/**
+ * @brief Counter-mode OrgWorld updating its tiles on several threads
+ */
+class TiledCandidate : public Candidate {
+    private:
+        Reference world;  ///< World under test
+
+    public:
+        TiledCandidate(const EcologyConfig & ecology, int seed, size_t num_threads, OrgWorld::UpdateMode update,
+                       OrgWorld::MoveMode move)
+            : world(ecology, seed, true, num_threads, OrgWorld::ScheduleMode::FULL_PERMUTATION, update, move) {}
+
+        size_t GetNumReplicates() const override { return 1; }
+        void Step() override { world.Step(); }
+        uint8_t GetSpecies(size_t, size_t pos) const override { return GetCellSpecies(world.GetWorld(), pos); }
+        double GetPoints(size_t, size_t pos) const override { return GetCellPoints(world.GetWorld(), pos); }
+};
+
+/**
+ * @brief Active-list OrgWorld that is checkpointed and restored into a new world part-way
+ *
+ * Everything the run depends on must survive the checkpoint, including the
+ * order the active list is scheduled in.
+ */
+class ResumeCandidate : public Candidate {
+    private:
+        static constexpr const char * PATH = "ae_equivalence-resume.aecp"; ///< Checkpoint file (removed after use)
+
+        emp::Ptr<emp::Random> random;  ///< Generator the world draws from
+        emp::Ptr<OrgWorld> world;      ///< World under test (replaced at resume_step)
+        size_t resume_step;            ///< Step after which the world is checkpointed and restored
+
+        /**
+         * @brief Build an empty active-list world
+         * @param width Grid width
+         * @param height Grid height
+         */
+        void MakeWorld(size_t width, size_t height) {
+            world = emp::NewPtr<OrgWorld>(*random);
+            world->SetPopStruct_Grid(width, height);
+            world->SetScheduleMode(OrgWorld::ScheduleMode::ACTIVE_LIST);
+        }
+
+    public:
+        ResumeCandidate(const EcologyConfig & ecology, int seed, size_t _resume_step)
+            : random(emp::NewPtr<emp::Random>(seed)), resume_step(_resume_step) {
+            MakeWorld(ecology.width, ecology.height);
+            PopulateWithMice(*world, *random, ecology);
+            PopulateWithOwls(*world, *random, ecology);
+        }
+
+        ~ResumeCandidate() override {
+            world.Delete();
+            random.Delete();
+        }
+
+        size_t GetNumReplicates() const override { return 1; }
+
+        void Step() override {
+            world->UpdateEcology();
+            if (world->GetStep() != resume_step) return;
+
+            const size_t width = world->GetWidth();
+            const size_t height = world->GetHeight();
+            std::string error;
+            if (!WriteCheckpoint(CaptureSnapshot(*world, *random), PATH)) error = "cannot write " + std::string(PATH);
+            world.Delete();
+            random.Delete();
+            random = emp::NewPtr<emp::Random>(1);
+            MakeWorld(width, height);
+            if (error.empty()) RestoreCheckpoint(PATH, *world, *random, error);
+            std::remove(PATH);
+            if (!error.empty()) std::cerr << "ae_equivalence: resume: " << error << std::endl;
+        }
+
+        uint8_t GetSpecies(size_t, size_t pos) const override { return GetCellSpecies(*world, pos); }
+        double GetPoints(size_t, size_t pos) const override { return GetCellPoints(*world, pos); }
+};
+
+/**
+ * @brief Compare every cell of every replicate and record the first difference
+ * @param references Reference worlds, one per replicate
+ * @param candidate Engine under test
+ * @param step Step being compared
+ * @param divergence Filled in on the first difference
+ * @return True if all cells matched
+ */
+static bool CompareCells(const emp::vector<emp::Ptr<Reference>> & references, const Candidate & candidate,
+                         size_t step, Divergence & divergence) {
+    for (size_t replicate = 0; replicate < references.size(); replicate++) {
+        const OrgWorld & world = references[replicate]->GetWorld();
+        for (size_t pos = 0; pos < world.GetSize(); pos++) {
+            const uint8_t reference_species = GetCellSpecies(world, pos);
+            const uint8_t candidate_species = candidate.GetSpecies(replicate, pos);
+            const double reference_points = GetCellPoints(world, pos);
+            const double candidate_points = candidate.GetPoints(replicate, pos);
+            if (reference_species == candidate_species && reference_points == candidate_points) continue;
+            divergence = { true, step, replicate, pos,
+                           reference_species, candidate_species, reference_points, candidate_points };
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Describe a species byte for the report
+ * @param species Species ID or GridWorld::EMPTY
+ * @return Species name
+ */
+static std::string SpeciesName(uint8_t species) {
+    if (species == Mouse::SPECIES_ID) return "mouse";
+    if (species == Owl::SPECIES_ID) return "owl";
+    if (species == GridWorld::EMPTY) return "grass";
+    return "species " + std::to_string(species);
+}
+
+/**
+ * @brief Print one result line
+ * @param engine Candidate name
+ * @param side Grid side length
+ * @param config Harness settings
+ * @param divergence First difference (if any)
+ * @param reference_seconds Time the reference spent stepping
+ * @param candidate_seconds Time the candidate spent stepping
+ */
+static void Report(const std::string & engine, size_t side, const EquivalenceConfig & config,
+                   const Divergence & divergence, double reference_seconds, double candidate_seconds) {
+    char timing[128];
+    std::snprintf(timing, sizeof(timing), "reference %.3f s, candidate %.3f s, speedup %.2fx",
+                  reference_seconds, candidate_seconds,
+                  candidate_seconds > 0.0 ? reference_seconds / candidate_seconds : 0.0);
+
+    std::cout << engine << " " << side << "x" << side << ": ";
+    if (!divergence.found) {
+        std::cout << "identical for " << config.steps << " steps; " << timing << std::endl;
+        return;
+    }
+    std::cout << "DIVERGED at step " << divergence.step
+              << ", seed " << config.seed + static_cast<int>(divergence.replicate)
+              << ", cell " << divergence.pos << " (" << divergence.pos % side << ", " << divergence.pos / side << "): "
+              << "reference " << SpeciesName(divergence.reference_species) << " " << divergence.reference_points
+              << ", candidate " << SpeciesName(divergence.candidate_species) << " " << divergence.candidate_points
+              << "; " << timing << std::endl;
+}
+
+/**
+ * @brief Step references and a candidate together, comparing after every step
+ * @param engine Candidate name
+ * @param side Grid side length
+ * @param config Harness settings
+ * @param references Reference worlds, one per candidate replicate
+ * @param candidate Engine under test
+ * @return True if the candidate matched throughout
+ */
+static bool CheckLockstep(const std::string & engine, size_t side, const EquivalenceConfig & config,
+                          const emp::vector<emp::Ptr<Reference>> & references, Candidate & candidate) {
+    Divergence divergence;
+    double reference_seconds = 0.0;
+    double candidate_seconds = 0.0;
+    CompareCells(references, candidate, 0, divergence);
+    for (size_t step = 1; step <= config.steps && !divergence.found; step++) {
+        Clock::time_point start = Clock::now();
+        for (emp::Ptr<Reference> reference : references) reference->Step();
+        reference_seconds += SecondsSince(start);
+
+        start = Clock::now();
+        candidate.Step();
+        candidate_seconds += SecondsSince(start);
+
+        CompareCells(references, candidate, step, divergence);
+    }
+    Report(engine, side, config, divergence, reference_seconds, candidate_seconds);
+    return !divergence.found;
+}
+
+/**
+ * @brief Build references for consecutive seeds
+ * @param ecology Grid size and starting population
+ * @param config Harness settings
+ * @param count Number of seeds
+ * @param counter Use --random counter
+ * @return One reference per seed (caller deletes)
+ */
+static emp::vector<emp::Ptr<Reference>> MakeReferences(const EcologyConfig & ecology, const EquivalenceConfig & config,
+                                                       size_t count, bool counter) {
+    emp::vector<emp::Ptr<Reference>> references;
+    for (size_t i = 0; i < count; i++) {
+        references.push_back(emp::NewPtr<Reference>(ecology, config.seed + static_cast<int>(i), counter));
+    }
+    return references;
+}
+
+/**
+ * @brief Check DistributedRunner against counter-mode OrgWorld
+ *
+ * Workers only report per-step counts and, at the end, the whole grid, so the
+ * step of a divergence is the first step whose counts differ (or the last
+ * step if only the final grid does), and the cell is reported only when the
+ * final grid differs.
+ * @param side Grid side length
+ * @param ecology Grid size and starting population
+ * @param config Harness settings
+ * @return True if the candidate matched throughout
+ */
+static bool CheckDistributed(size_t side, const EcologyConfig & ecology, const EquivalenceConfig & config) {
+    DistributedRunner runner(ecology, config.processes);
+    std::string error;
+    if (!runner.IsValid(error)) {
+        std::cout << "distributed " << side << "x" << side << ": skipped (" << error << ")" << std::endl;
+        return true;
+    }
+
+    Reference reference(ecology, config.seed, true);
+    emp::vector<std::array<size_t, RegisteredSpecies::SIZE>> reference_counts;
+    reference_counts.push_back(CountSpecies(reference.GetWorld()));
+    double reference_seconds = 0.0;
+    for (size_t step = 1; step <= config.steps; step++) {
+        const Clock::time_point start = Clock::now();
+        reference.Step();
+        reference_seconds += SecondsSince(start);
+        reference_counts.push_back(CountSpecies(reference.GetWorld()));
+    }
+
+    Divergence divergence;
+    DistributedGrid grid;
+    const Clock::time_point start = Clock::now();
+    const bool ran = runner.Run(config.seed, config.steps,
+        [&](size_t step, const std::array<size_t, RegisteredSpecies::SIZE> & counts) {
+            if (!divergence.found && counts != reference_counts[step]) {
+                divergence.found = true;
+                divergence.step = step;
+            }
+        }, error, &grid);
+    const double candidate_seconds = SecondsSince(start);
+    if (!ran) {
+        std::cout << "distributed " << side << "x" << side << ": FAILED (" << error << ")" << std::endl;
+        return false;
+    }
+
+    const OrgWorld & world = reference.GetWorld();
+    for (size_t pos = 0; pos < world.GetSize(); pos++) {
+        const uint8_t reference_species = GetCellSpecies(world, pos);
+        const double reference_points = GetCellPoints(world, pos);
+        if (reference_species == grid.species[pos] && reference_points == grid.energy[pos]) continue;
+        if (!divergence.found) divergence.step = config.steps;
+        divergence.found = true;
+        divergence.pos = pos;
+        divergence.reference_species = reference_species;
+        divergence.candidate_species = grid.species[pos];
+        divergence.reference_points = reference_points;
+        divergence.candidate_points = grid.energy[pos];
+        break;
+    }
+    Report("distributed", side, config, divergence, reference_seconds, candidate_seconds);
+    return !divergence.found;
+}
+
+/**
+ * @brief Mean count of each species over a run, averaged across seeds
+ */
+struct SpeciesMeans {
+    std::array<double, RegisteredSpecies::SIZE> sums = {};     ///< Sum over seeds of each run's mean count
+    std::array<double, RegisteredSpecies::SIZE> squares = {};  ///< Sum over seeds of its square
+    size_t seeds = 0;                                          ///< Runs added
+
+    /**
+     * @brief Step a world and add its mean species counts over the run
+     * @param world World to run
+     * @param steps Steps to run
+     * @return Seconds spent inside UpdateEcology
+     */
+    template <typename WORLD>
+    double AddRun(WORLD & world, size_t steps) {
+        std::array<double, RegisteredSpecies::SIZE> totals = {};
+        double seconds = 0.0;
+        for (size_t step = 1; step <= steps; step++) {
+            const Clock::time_point start = Clock::now();
+            world.UpdateEcology();
+            seconds += SecondsSince(start);
+            const std::array<size_t, RegisteredSpecies::SIZE> counts = CountSpecies(world);
+            for (size_t s = 0; s < counts.size(); s++) totals[s] += static_cast<double>(counts[s]);
+        }
+        for (size_t s = 0; s < totals.size(); s++) {
+            const double mean = totals[s] / static_cast<double>(steps > 0 ? steps : 1);
+            sums[s] += mean;
+            squares[s] += mean * mean;
+        }
+        seeds++;
+        return seconds;
+    }
+
+    double GetMean(size_t species) const { return sums[species] / seeds; }
+
+    /**
+     * @brief Get the sample variance of a species' run mean across seeds
+     * @param species Species ID
+     * @return Variance (needs at least 2 seeds)
+     */
+    double GetVariance(size_t species) const {
+        const double mean = GetMean(species);
+        const double variance = (squares[species] - seeds * mean * mean) / (seeds - 1);
+        return variance > 0.0 ? variance : 0.0;
+    }
+};
+
+/**
+ * @brief Check ChunkedWorld against active-list OrgWorld over many seeds
+ *
+ * ChunkedWorld draws differently from every OrgWorld mode, so the two are
+ * compared on outcomes rather than cells: each species' mean count over the
+ * run, averaged across config.samples seeds per engine, must differ by at
+ * most MAX_Z standard errors. The reference uses --schedule active, which
+ * also makes newborns wait a step.
+ * @param side Grid side length
+ * @param ecology Grid size and starting population
+ * @param config Harness settings
+ * @return True if every species' means agree
+ */
+static bool CheckChunked(size_t side, const EcologyConfig & ecology, const EquivalenceConfig & config) {
+    constexpr double MAX_Z = 4.0;
+
+    SpeciesMeans reference_means;
+    SpeciesMeans candidate_means;
+    double reference_seconds = 0.0;
+    double candidate_seconds = 0.0;
+    for (size_t i = 0; i < config.samples; i++) {
+        const int seed = config.seed + static_cast<int>(i);
+        emp::Random reference_random(seed);
+        OrgWorld reference(reference_random);
+        reference.SetPopStruct_Grid(ecology.width, ecology.height);
+        reference.SetScheduleMode(OrgWorld::ScheduleMode::ACTIVE_LIST);
+        PopulateWithMice(reference, reference_random, ecology);
+        PopulateWithOwls(reference, reference_random, ecology);
+        reference_seconds += reference_means.AddRun(reference, config.steps);
+
+        emp::Random candidate_random(seed);
+        ChunkedWorld candidate(candidate_random, ecology.width, ecology.height);
+        PopulateWithMice(candidate, candidate_random, ecology);
+        PopulateWithOwls(candidate, candidate_random, ecology);
+        candidate_seconds += candidate_means.AddRun(candidate, config.steps);
+    }
+
+    bool agreed = true;
+    std::ostringstream detail;
+    for (size_t s = 0; s < RegisteredSpecies::SIZE; s++) {
+        const double difference = std::abs(candidate_means.GetMean(s) - reference_means.GetMean(s));
+        const double error = std::sqrt((reference_means.GetVariance(s) + candidate_means.GetVariance(s)) / config.samples);
+        const double z = error > 0.0 ? difference / error : (difference > 0.0 ? INFINITY : 0.0);
+        if (z > MAX_Z) agreed = false;
+        char text[128];
+        std::snprintf(text, sizeof(text), "%s%s %.1f vs %.1f (z %.2f)", s > 0 ? ", " : "",
+                      SpeciesName(static_cast<uint8_t>(s)).c_str(), reference_means.GetMean(s),
+                      candidate_means.GetMean(s), z);
+        detail << text;
+    }
+
+    char timing[128];
+    std::snprintf(timing, sizeof(timing), "reference %.3f s, candidate %.3f s, speedup %.2fx",
+                  reference_seconds, candidate_seconds,
+                  candidate_seconds > 0.0 ? reference_seconds / candidate_seconds : 0.0);
+    std::cout << "chunked " << side << "x" << side << ": "
+              << (agreed ? "statistically equivalent" : "DIFFERED") << " over " << config.samples
+              << " seeds; mean counts " << detail.str() << "; " << timing << std::endl;
+    return agreed;
+}
+
+/**
+ * @brief Check that a recorded run decodes back to the grids it was recorded from
+ *
+ * Records every step of a reference run with a short keyframe interval and
+ * keeps each grid, then seeks every recorded step with TrajectoryReader. The
+ * same is checked on two cut copies of the file: one ending where the index
+ * starts, so the reader must rebuild the index from the frames, and one
+ * ending inside the last frame, which the reader must drop.
+ * @param side Grid side length
+ * @param ecology Grid size and starting population
+ * @param config Harness settings
+ * @return True if every copy decodes as expected
+ */
+static bool CheckTrajectory(size_t side, const EcologyConfig & ecology, const EquivalenceConfig & config) {
+    constexpr size_t KEYFRAME_INTERVAL = 8;
+    const std::string path = "ae_equivalence-trajectory.aetr";
+    const std::string cut_path = path + ".cut";
+
+    emp::vector<emp::vector<uint8_t>> grids;
+    bool recorded;
+    {
+        Reference reference(ecology, config.seed, false);
+        const OrgWorld & world = reference.GetWorld();
+        TrajectoryRecorder recorder(path, ecology.width, ecology.height, 1, KEYFRAME_INTERVAL);
+        for (size_t step = 0; step <= config.steps; step++) {
+            if (step > 0) reference.Step();
+            recorder.Capture(world);
+            grids.emplace_back(world.GetSize());
+            for (size_t pos = 0; pos < world.GetSize(); pos++) grids.back()[pos] = GetCellSpecies(world, pos);
+        }
+        recorder.Close();
+        recorded = recorder.IsOpen();
+    }
+
+    std::string bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    uint64_t index_offset = 0;
+    if (bytes.size() >= sizeof(index_offset) + 4) {
+        std::memcpy(&index_offset, bytes.data() + bytes.size() - sizeof(index_offset) - 4, sizeof(index_offset));
+    }
+    if (!recorded || index_offset == 0 || index_offset >= bytes.size()) {
+        std::cout << "trajectory " << side << "x" << side << ": FAILED to record " << path << std::endl;
+        std::remove(path.c_str());
+        return false;
+    }
+
+    // Seeks steps 0..last_step (each must match) and last_step + 1 (must fail)
+    std::string failure;
+    auto check = [&](const std::string & file, size_t last_step, const std::string & label) {
+        TrajectoryReader reader;
+        std::string error;
+        if (!reader.Open(file, error)) {
+            failure = label + ": " + error;
+            return false;
+        }
+        const size_t keyframes = (last_step + KEYFRAME_INTERVAL) / KEYFRAME_INTERVAL;
+        if (reader.GetKeyframes().size() != keyframes) {
+            failure = label + ": " + std::to_string(reader.GetKeyframes().size()) + " keyframes, expected "
+                + std::to_string(keyframes);
+            return false;
+        }
+        emp::vector<uint8_t> grid;
+        for (size_t step = 0; step <= last_step; step++) {
+            if (!reader.Seek(step, grid) || grid != grids[step]) {
+                failure = label + ": step " + std::to_string(step) + " did not decode to the live grid";
+                return false;
+            }
+        }
+        if (reader.Seek(last_step + 1, grid)) {
+            failure = label + ": step " + std::to_string(last_step + 1) + " decoded but was not recorded";
+            return false;
+        }
+        return true;
+    };
+    auto cut = [&](size_t size) {
+        std::ofstream file(cut_path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(size));
+    };
+
+    bool matched = check(path, config.steps, "indexed file");
+    if (matched) {
+        cut(index_offset);
+        matched = check(cut_path, config.steps, "file cut before its index");
+    }
+    if (matched && config.steps > 0) {
+        cut(index_offset - 1);
+        matched = check(cut_path, config.steps - 1, "file cut inside its last frame");
+    }
+    std::remove(path.c_str());
+    std::remove(cut_path.c_str());
+
+    std::cout << "trajectory " << side << "x" << side << ": ";
+    if (matched) {
+        std::cout << grids.size() << " recorded steps decode to the live grid with the index, with the file cut "
+                  << "before its index, and (all but the last) with it cut inside its last frame" << std::endl;
+    } else {
+        std::cout << "DIVERGED in the " << failure << std::endl;
+    }
+    return matched;
+}
+
+/**
+ * @brief Label the patches of one cell type by breadth-first search
+ *
+ * The plain single-threaded labeling FindClusters must agree with.
+ * @param snapshot Grid to measure
+ * @param species Cell type to group
+ * @return Size of every patch, largest first
+ */
+static emp::vector<size_t> BreadthFirstClusters(const SpatialSnapshot & snapshot, uint8_t species) {
+    const size_t width = snapshot.width;
+    const size_t height = snapshot.height;
+    emp::vector<bool> seen(width * height, false);
+    emp::vector<size_t> queue;
+    emp::vector<size_t> sizes;
+    for (size_t start = 0; start < seen.size(); start++) {
+        if (seen[start] || snapshot.species[start] != species) continue;
+        seen[start] = true;
+        queue.assign(1, start);
+        for (size_t next = 0; next < queue.size(); next++) {
+            const size_t x = queue[next] % width;
+            const size_t y = queue[next] / width;
+            for (size_t dy = 0; dy < 3; dy++) {
+                for (size_t dx = 0; dx < 3; dx++) {
+                    const size_t j = (y + height + dy - 1) % height * width + (x + width + dx - 1) % width;
+                    if (seen[j] || snapshot.species[j] != species) continue;
+                    seen[j] = true;
+                    queue.push_back(j);
+                }
+            }
+        }
+        sizes.push_back(queue.size());
+    }
+    std::sort(sizes.begin(), sizes.end(), std::greater<size_t>());
+    return sizes;
+}
+
+/**
+ * @brief Check SpatialAnalysis::FindClusters against breadth-first labeling
+ *
+ * Runs on a square grid of the given side and on thinner grids of the
+ * same length, each filled at several densities, plus a ring along the
+ * grid's edges that only the wrap in both directions joins into one patch.
+ * Every grid is measured with pools of several sizes, so the rows are split
+ * into different numbers of strips.
+ * @param side Grid side length
+ * @param config Harness settings (the seed fills the grids)
+ * @return True if every patch size list matched
+ */
+static bool CheckClusters(size_t side, const EquivalenceConfig & config) {
+    constexpr size_t GRIDS_PER_DENSITY = 2;
+    const emp::vector<double> densities = { 0.3, 0.55, 0.8 };
+    const emp::vector<size_t> pool_threads = { 1, 2, 3, 7 };
+    const emp::vector<std::pair<size_t, size_t>> shapes = {
+        { side, side }, { side, 2 }, { 2, side }, { side, side / 2 + 1 }
+    };
+
+    emp::vector<emp::Ptr<ThreadPool>> pools;
+    for (size_t threads : pool_threads) pools.push_back(emp::NewPtr<ThreadPool>(threads));
+    emp::Random random(config.seed);
+    size_t grids = 0;
+    std::string failure;
+    for (const auto & shape : shapes) {
+        SpatialSnapshot snapshot;
+        snapshot.width = shape.first;
+        snapshot.height = shape.second;
+        // Fill 0 is the edge ring, then GRIDS_PER_DENSITY random grids per density
+        for (size_t fill = 0; fill <= densities.size() * GRIDS_PER_DENSITY && failure.empty(); fill++) {
+            const double density = fill > 0 ? densities[(fill - 1) / GRIDS_PER_DENSITY] : 0.0;
+            snapshot.species.assign(snapshot.width * snapshot.height, GridWorld::EMPTY);
+            for (size_t i = 0; i < snapshot.species.size(); i++) {
+                const size_t x = i % snapshot.width;
+                const size_t y = i / snapshot.width;
+                const bool on_edge = x == 0 || y == 0 || x + 1 == snapshot.width || y + 1 == snapshot.height;
+                if (fill == 0 ? on_edge : random.P(density)) snapshot.species[i] = Mouse::SPECIES_ID;
+            }
+            grids++;
+
+            const emp::vector<size_t> expected = BreadthFirstClusters(snapshot, Mouse::SPECIES_ID);
+            for (emp::Ptr<ThreadPool> pool : pools) {
+                const ClusterStats found = SpatialAnalysis::FindClusters(snapshot, Mouse::SPECIES_ID, *pool);
+                if (found.sizes == expected) continue;
+                std::ostringstream detail;
+                detail << snapshot.width << "x" << snapshot.height << " grid ";
+                if (fill == 0) detail << "with an edge ring";
+                else detail << "filled at " << density;
+                detail << " on " << pool->GetNumThreads() << " threads: " << found.GetCount() << " patches (largest "
+                       << found.GetLargest() << ") vs " << expected.size() << " (largest "
+                       << (expected.empty() ? 0 : expected[0]) << ")";
+                failure = detail.str();
+                break;
+            }
+        }
+    }
+    for (emp::Ptr<ThreadPool> pool : pools) pool.Delete();
+
+    std::cout << "clusters " << side << "x" << side << ": ";
+    if (failure.empty()) {
+        std::cout << "FindClusters matched breadth-first labeling on " << grids << " grids, each on "
+                  << pools.size() << " pool sizes" << std::endl;
+    } else {
+        std::cout << "DIVERGED on the " << failure << std::endl;
+    }
+    return failure.empty();
+}
+
+/**
+ * @brief Check that keyed shuffles of small lists are uniform
+ *
+ * Shuffles 0..n-1 once per step for SAMPLES_PER_ORDER * n! steps and counts
+ * each resulting order. Every order must appear, and every count must lie
+ * within MAX_Z binomial standard deviations of the expected count.
+ * @param config Harness settings (the seed keys the draws)
+ * @return True if every list size passed
+ */
+static bool CheckShuffle(const EquivalenceConfig & config) {
+    constexpr size_t MAX_ITEMS = 5;
+    constexpr size_t SAMPLES_PER_ORDER = 2000;
+    constexpr double MAX_Z = 5.0;
+
+    const CounterRandom random(static_cast<uint32_t>(config.seed));
+    bool uniform = true;
+    for (size_t n = 2; n <= MAX_ITEMS; n++) {
+        size_t num_orders = 1;
+        for (size_t k = 2; k <= n; k++) num_orders *= k;
+        const size_t samples = SAMPLES_PER_ORDER * num_orders;
+
+        // Orders are counted by their digits in base n
+        size_t num_codes = 1;
+        for (size_t k = 0; k < n; k++) num_codes *= n;
+        emp::vector<size_t> counts(num_codes, 0);
+        emp::vector<size_t> items(n);
+        for (size_t step = 0; step < samples; step++) {
+            for (size_t k = 0; k < n; k++) items[k] = k;
+            random.Shuffle(step, 0, items);
+            size_t code = 0;
+            for (size_t item : items) code = code * n + item;
+            counts[code]++;
+        }
+
+        const double expected = static_cast<double>(samples) / num_orders;
+        const double limit = MAX_Z * std::sqrt(expected * (1.0 - 1.0 / num_orders));
+        size_t seen = 0;
+        size_t lowest = samples;
+        size_t highest = 0;
+        for (size_t count : counts) {
+            if (count == 0) continue;
+            seen++;
+            lowest = std::min(lowest, count);
+            highest = std::max(highest, count);
+        }
+        const bool passed = seen == num_orders && expected - lowest <= limit && highest - expected <= limit;
+        if (!passed) uniform = false;
+        std::cout << "shuffle " << n << " items: " << (passed ? "uniform" : "NOT UNIFORM") << ", " << seen << " of "
+                  << num_orders << " orders, counts " << lowest << " to " << highest << " (expected "
+                  << expected << ")" << std::endl;
+    }
+    return uniform;
+}
+
+/**
+ * @brief Check one candidate at one grid size
+ * @param engine Candidate name
+ * @param side Grid side length
+ * @param config Harness settings
+ * @return True if the candidate matched throughout
+ */
+static bool CheckEngine(const std::string & engine, size_t side, const EquivalenceConfig & config) {
+    EcologyConfig ecology;
+    ecology.width = side;
+    ecology.height = side;
+
+    if (engine == "distributed") return CheckDistributed(side, ecology, config);
+    if (engine == "chunked") return CheckChunked(side, ecology, config);
+    if (engine == "trajectory") return CheckTrajectory(side, ecology, config);
+    if (engine == "clusters") return CheckClusters(side, config);
+
+    emp::vector<emp::Ptr<Reference>> references;
+    emp::Ptr<Candidate> candidate;
+    if (engine == "grid") {
+        references = MakeReferences(ecology, config, 1, false);
+        candidate = emp::NewPtr<GridCandidate>(ecology, config.seed);
+    } else if (engine == "ensemble") {
+        references = MakeReferences(ecology, config, EnsembleWorld<>::NUM_LANES, false);
+        emp::vector<int> seeds;
+        for (size_t i = 0; i < references.size(); i++) seeds.push_back(config.seed + static_cast<int>(i));
+        candidate = emp::NewPtr<EnsembleCandidate>(ecology, seeds);
+    } else if (engine == "resume") {
+        references.push_back(emp::NewPtr<Reference>(ecology, config.seed, false, 1, OrgWorld::ScheduleMode::ACTIVE_LIST));
+        candidate = emp::NewPtr<ResumeCandidate>(ecology, config.seed, std::max<size_t>(config.steps / 2, 1));
+    } else {
+        const OrgWorld::UpdateMode update = engine == "tiled-sync" ? OrgWorld::UpdateMode::SYNCHRONOUS
+                                                                   : OrgWorld::UpdateMode::ASYNCHRONOUS;
+        const OrgWorld::MoveMode move = engine == "tiled-two-phase" ? OrgWorld::MoveMode::TWO_PHASE
+                                                                    : OrgWorld::MoveMode::SEQUENTIAL;
+        references.push_back(emp::NewPtr<Reference>(ecology, config.seed, true, 1,
+                                                    OrgWorld::ScheduleMode::FULL_PERMUTATION, update, move));
+        candidate = emp::NewPtr<TiledCandidate>(ecology, config.seed, config.threads, update, move);
+    }
+
+    const bool matched = CheckLockstep(engine, side, config, references, *candidate);
+    candidate.Delete();
+    for (emp::Ptr<Reference> reference : references) reference.Delete();
+    return matched;
+}
+
+int main(int argc, char* argv[]) {
+    EquivalenceConfig config;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string flag = argv[i];
+        const std::string value = argv[i + 1];
+        if (flag == "--sizes") {
+            config.sizes.clear();
+            for (const std::string & item : SplitList(value)) config.sizes.push_back(std::stoul(item));
+        } else if (flag == "--steps") {
+            config.steps = std::stoul(value);
+        } else if (flag == "--seed") {
+            config.seed = std::stoi(value);
+        } else if (flag == "--engines") {
+            config.engines = SplitList(value);
+        } else if (flag == "--threads") {
+            config.threads = std::stoul(value);
+        } else if (flag == "--processes") {
+            config.processes = std::stoul(value);
+        } else if (flag == "--samples") {
+            config.samples = std::stoul(value);
+        } else {
+            std::cerr << "ae_equivalence: unknown flag " << flag << std::endl;
+            return 1;
+        }
+    }
+    for (const std::string & engine : config.engines) {
+        if (engine != "shuffle" && engine != "grid" && engine != "ensemble" && engine != "tiled"
+            && engine != "tiled-sync" && engine != "tiled-two-phase" && engine != "resume"
+            && engine != "distributed" && engine != "chunked" && engine != "trajectory"
+            && engine != "clusters") {
+            std::cerr << "ae_equivalence: unknown engine " << engine << std::endl;
+            return 1;
+        }
+    }
+    if (config.samples < 2) {
+        std::cerr << "ae_equivalence: --samples must be at least 2" << std::endl;
+        return 1;
+    }
+
+    size_t diverged = 0;
+    if (std::find(config.engines.begin(), config.engines.end(), "shuffle") != config.engines.end()
+        && !CheckShuffle(config)) {
+        diverged++;
+    }
+    for (size_t side : config.sizes) {
+        for (const std::string & engine : config.engines) {
+            if (engine != "shuffle" && !CheckEngine(engine, side, config)) diverged++;
+        }
+    }
+    if (diverged > 0) {
+        std::cout << diverged << " configuration(s) diverged" << std::endl;
+        return 1;
+    }
+    std::cout << "all candidates matched the reference" << std::endl;
+    return 0;
+}
@@ -1,36 +1,70 @@
 #include <iostream>
-#include "emp/math/Random.hpp"
+#include <string>
 
-#include "World.h"
-#include "Org.h"
-#include "Mouse.h"
-#include "Owl.h"
+#include "BatchRunner.h"
 
 // You run this from going "./compile-run-native.sh" in the terminal.
+//
+// Headless batch driver: runs every seed in a range as an independent
+// replicate across all cores and streams per-step population counts.
+// "./ae_lab --help" lists every setting.
 
-int main() {
-    emp::Random random(5);  
-    OrgWorld world(random);
-    
-    Mouse* new_org1 = new Mouse(&random, 0.0, 0); // Create organism of species 0
-    world.Inject(*new_org1);
-    
-    Owl* new_org2 = new Owl(&random, 0.0, 1); // Create organism of species 1
-    world.Inject(*new_org2);
-    
-    // Resize the world to a 10x10 grid
-    world.Resize(10, 10);
-    world.SetPopStruct_Grid(10, 10); // Set population structure to grid for spatial constraints
-    
-    std::cout << "World size: " << world.GetSize() << std::endl;
-    std::cout << "Number of organisms: " << world.GetNumOrgs() << std::endl;
-    
-    std::cout << "Running simulation for 10 updates..." << std::endl;
-    for (int i = 0; i < 10; i++) {
-        std::cout << "Update " << i << std::endl;
-        world.Update();
-        std::cout << "Population after update " << i << ": " << world.GetNumOrgs() << std::endl;
+/// Printed by --help
+static const char * const USAGE =
+    "usage: ae_lab [--key value]... [--config file]\n"
+    "\n"
+    "Settings come from \"--key value\" flags and/or \"--config file\" (lines of\n"
+    "\"key = value\"); later settings override earlier ones. Counts must not be\n"
+    "negative. For example:\n"
+    "\n"
+    "  ./ae_lab --width 256 --height 256 --steps 5000 --seeds 1:1000 --out runs.csv\n"
+    "\n"
+    "Settings: width, height, mouse-ratio, owl-ratio, mouse-energy, owl-energy,\n"
+    "steps, seeds (N or first:last), threads (0 = all cores), engine (org|grid|\n"
+    "chunked|ensemble|distributed; chunked stores and visits only 64x64 chunks\n"
+    "holding organisms, with newborns waiting a step as in schedule active;\n"
+    "ensemble runs 8 seeds per world in lockstep with the\n"
+    "grid engine's rows and no checkpoints; distributed splits each seed's grid\n"
+    "across forked processes and needs random counter), processes (workers per\n"
+    "seed for distributed),\n"
+    "schedule (full|active|block; active schedules only occupied cells, OrgWorld\n"
+    "only; block shuffles the grid block by block, grid engine only),\n"
+    "random (stream|counter; counter keys every draw by step and cell, OrgWorld only),\n"
+    "move (sequential|two-phase; two-phase proposes every move before applying\n"
+    "any, OrgWorld only), update (asynchronous|synchronous; synchronous reads\n"
+    "the previous step's grid and writes a new one, OrgWorld only),\n"
+    "world-threads (threads each replicate's update is tiled across, OrgWorld\n"
+    "only; on top of threads, so threads * world-threads run at once),\n"
+    "format (csv|binary), out (path or - for stdout), checkpoint-every (steps,\n"
+    "0 = off), checkpoint-prefix, resume (checkpoint to continue exactly) and\n"
+    "fork (checkpoint to start every seed from, reseeded per replicate),\n"
+    "record-every (steps between trajectory frames, 0 = off) and record-prefix,\n"
+    "analyze-every (steps between spatial analyses, 0 = off; csv only, not\n"
+    "distributed), analysis-distance (largest owl-mouse distance) and\n"
+    "analysis-threads (threads per replicate's analysis), on-absorbing,\n"
+    "on-extinction and on-steady (run|stop|fast-forward; what a replicate does\n"
+    "once its world is empty, a species dies out or its counts are stationary;\n"
+    "not distributed), steady-window (steps per window) and steady-tolerance\n"
+    "(largest shift in mean count between windows, in standard deviations).\n";
+
+int main(int argc, char* argv[]) {
+    BatchConfig config;
+    std::string error;
+    if (!config.ParseArgs(argc, argv, error)) {
+        std::cerr << "ae_lab: " << error << std::endl;
+        return 1;
+    }
+    if (config.help) {
+        std::cout << USAGE;
+        return 0;
     }
-    
-    return 0;
-}
\ No newline at end of file
+
+    SummaryWriter writer(config.output, config.format, config.analyze_every > 0 ? config.analysis_distance : 0);
+    if (!writer.IsOpen()) {
+        std::cerr << "ae_lab: cannot write " << config.output << std::endl;
+        return 1;
+    }
+
+    BatchRunner runner(config);
+    return runner.Run(writer) ? 0 : 1;
+}